@@ -76,8 +76,9 @@ Status MakeArrayFromValidBytes(
     RETURN_NOT_OK(value_builder.Append<int32_t>(0));
   }
 
-  *out = std::make_shared<Int32Array>(
-      v.size(), value_builder.Finish(), null_buf, null_count);
+  std::shared_ptr<Buffer> values;
+  RETURN_NOT_OK(value_builder.Finish(&values));
+  *out = std::make_shared<Int32Array>(v.size(), values, null_buf, null_count);
   return Status::OK();
 }
 
@@ -1031,6 +1032,70 @@ TEST_F(TestBinaryBuilder, TestZeroLength) {
   Done();
 }
 
+TEST_F(TestBinaryBuilder, TestBulkAppendOffsets) {
+  const std::string data = "xxbbaccc";
+  // Offsets need not start at zero
+  vector<int32_t> offsets = {2, 2, 4, 5, 5, 8};
+  vector<uint8_t> valid_bytes = {1, 1, 1, 0, 1};
+  const auto raw_data = reinterpret_cast<const uint8_t*>(data.data());
+
+  // Interleave with scalar appends so the offsets must be rebased
+  ASSERT_OK(builder_->Append("dd"));
+  ASSERT_OK(builder_->Append(raw_data, offsets.data(), 5, valid_bytes.data()));
+  ASSERT_OK(builder_->Append(raw_data, offsets.data() + 1, 2));
+  ASSERT_OK(builder_->Append("e"));
+  Done();
+
+  vector<string> expected = {"dd", "", "bb", "a", "", "ccc", "bb", "a", "e"};
+  ASSERT_EQ(static_cast<int64_t>(expected.size()), result_->length());
+  ASSERT_EQ(1, result_->null_count());
+  ASSERT_TRUE(result_->IsNull(4));
+
+  int32_t length;
+  for (int i = 0; i < result_->length(); ++i) {
+    if (i == 4) { continue; }
+    const uint8_t* vals = result_->GetValue(i, &length);
+    ASSERT_EQ(static_cast<int>(expected[i].size()), length);
+    ASSERT_EQ(0, std::memcmp(vals, expected[i].data(), length));
+  }
+}
+
+TEST_F(TestBinaryBuilder, TestBulkAppendValues) {
+  vector<string> strings = {"", "bb", "a", "zzzz", "ccc"};
+  vector<uint8_t> valid_bytes = {1, 1, 1, 0, 1};
+
+  vector<std::pair<const uint8_t*, int32_t>> values;
+  for (const auto& value : strings) {
+    values.emplace_back(reinterpret_cast<const uint8_t*>(value.data()),
+        static_cast<int32_t>(value.size()));
+  }
+
+  int reps = 100;
+  for (int j = 0; j < reps; ++j) {
+    ASSERT_OK(builder_->Append(values, valid_bytes.data()));
+  }
+  ASSERT_OK(builder_->Append(values));
+  Done();
+
+  const int N = static_cast<int>(strings.size());
+  ASSERT_EQ((reps + 1) * N, result_->length());
+  ASSERT_EQ(reps, result_->null_count());
+  // Null values are not copied
+  ASSERT_EQ(reps * 6 + 10, result_->data()->size());
+
+  int32_t length;
+  for (int i = 0; i < result_->length(); ++i) {
+    if (i < reps * N && !valid_bytes[i % N]) {
+      ASSERT_TRUE(result_->IsNull(i));
+      continue;
+    }
+    ASSERT_FALSE(result_->IsNull(i));
+    const uint8_t* vals = result_->GetValue(i, &length);
+    ASSERT_EQ(static_cast<int>(strings[i % N].size()), length);
+    ASSERT_EQ(0, std::memcmp(vals, strings[i % N].data(), length));
+  }
+}
+
 // ----------------------------------------------------------------------
 // Slice tests
 
@@ -1527,7 +1592,7 @@ TYPED_TEST(TestDictionaryBuilder, Basic) {
   auto dtype =
       std::make_shared<DictionaryType>(std::make_shared<TypeParam>(), dict_array);
 
-  UInt8Builder int_builder(default_memory_pool());
+  Int32Builder int_builder(default_memory_pool());
   ASSERT_OK(int_builder.Append(0));
   ASSERT_OK(int_builder.Append(1));
   ASSERT_OK(int_builder.Append(0));
@@ -1561,7 +1626,7 @@ TYPED_TEST(TestDictionaryBuilder, ArrayConversion) {
   auto dtype =
       std::make_shared<DictionaryType>(std::make_shared<TypeParam>(), dict_array);
 
-  UInt8Builder int_builder(default_memory_pool());
+  Int32Builder int_builder(default_memory_pool());
   ASSERT_OK(int_builder.Append(0));
   ASSERT_OK(int_builder.Append(1));
   ASSERT_OK(int_builder.Append(0));
@@ -1580,13 +1645,13 @@ TYPED_TEST(TestDictionaryBuilder, DoubleTableSize) {
     DictionaryBuilder<TypeParam> builder(default_memory_pool());
     // Build expected data
     NumericBuilder<TypeParam> dict_builder(default_memory_pool());
-    UInt16Builder int_builder(default_memory_pool());
+    Int32Builder int_builder(default_memory_pool());
 
     // Fill with 1024 different values
     for (int64_t i = 0; i < 1024; i++) {
       ASSERT_OK(builder.Append(static_cast<Scalar>(i)));
       ASSERT_OK(dict_builder.Append(static_cast<Scalar>(i)));
-      ASSERT_OK(int_builder.Append(static_cast<uint16_t>(i)));
+      ASSERT_OK(int_builder.Append(static_cast<int32_t>(i)));
     }
     // Fill with an already existing value
     for (int64_t i = 0; i < 1024; i++) {
@@ -1611,6 +1676,45 @@ TYPED_TEST(TestDictionaryBuilder, DoubleTableSize) {
   }
 }
 
+TYPED_TEST(TestDictionaryBuilder, FinishKeepsDictionary) {
+  using Scalar = typename TypeParam::c_type;
+  DictionaryBuilder<TypeParam> builder(default_memory_pool());
+  ASSERT_OK(builder.Append(static_cast<Scalar>(1)));
+  ASSERT_OK(builder.Append(static_cast<Scalar>(2)));
+  std::shared_ptr<Array> result1;
+  ASSERT_OK(builder.Finish(&result1));
+
+  ASSERT_OK(builder.Append(static_cast<Scalar>(3)));
+  ASSERT_OK(builder.Append(static_cast<Scalar>(1)));
+  std::shared_ptr<Array> result2;
+  ASSERT_OK(builder.Finish(&result2));
+
+  // The second dictionary extends the first
+  NumericBuilder<TypeParam> dict_builder(default_memory_pool());
+  for (int i = 1; i <= 3; ++i) {
+    ASSERT_OK(dict_builder.Append(static_cast<Scalar>(i)));
+  }
+  std::shared_ptr<Array> dict_array;
+  ASSERT_OK(dict_builder.Finish(&dict_array));
+  const auto& dict1 = static_cast<const DictionaryArray&>(*result1).dictionary();
+  const auto& dict2 = static_cast<const DictionaryArray&>(*result2).dictionary();
+  ASSERT_TRUE(dict2->Equals(dict_array));
+  ASSERT_TRUE(dict2->RangeEquals(0, dict1->length(), 0, dict1));
+
+  // The index type does not depend on the size of the dictionary
+  for (const auto& result : {result1, result2}) {
+    const auto& type = static_cast<const DictionaryType&>(*result->type());
+    ASSERT_TRUE(type.index_type()->Equals(int32()));
+  }
+
+  Int32Builder int_builder(default_memory_pool());
+  ASSERT_OK(int_builder.Append(2));
+  ASSERT_OK(int_builder.Append(0));
+  std::shared_ptr<Array> int_array;
+  ASSERT_OK(int_builder.Finish(&int_array));
+  ASSERT_TRUE(static_cast<const DictionaryArray&>(*result2).indices()->Equals(int_array));
+}
+
 TEST(TestStringDictionaryBuilder, Basic) {
   // Build the dictionary Array
   StringDictionaryBuilder builder(default_memory_pool());
@@ -1629,7 +1733,7 @@ TEST(TestStringDictionaryBuilder, Basic) {
   ASSERT_OK(str_builder.Finish(&str_array));
   auto dtype = std::make_shared<DictionaryType>(utf8(), str_array);
 
-  UInt8Builder int_builder(default_memory_pool());
+  Int32Builder int_builder(default_memory_pool());
   ASSERT_OK(int_builder.Append(0));
   ASSERT_OK(int_builder.Append(1));
   ASSERT_OK(int_builder.Append(0));
@@ -1640,12 +1744,39 @@ TEST(TestStringDictionaryBuilder, Basic) {
   ASSERT_TRUE(expected.Equals(result));
 }
 
+TEST(TestStringDictionaryBuilder, FinishKeepsDictionary) {
+  StringDictionaryBuilder builder(default_memory_pool());
+  ASSERT_OK(builder.Append("test"));
+  std::shared_ptr<Array> result1;
+  ASSERT_OK(builder.Finish(&result1));
+
+  ASSERT_OK(builder.Append("test2"));
+  ASSERT_OK(builder.Append("test"));
+  std::shared_ptr<Array> result2;
+  ASSERT_OK(builder.Finish(&result2));
+
+  StringBuilder str_builder(default_memory_pool());
+  ASSERT_OK(str_builder.Append("test"));
+  ASSERT_OK(str_builder.Append("test2"));
+  std::shared_ptr<Array> str_array;
+  ASSERT_OK(str_builder.Finish(&str_array));
+  ASSERT_TRUE(
+      static_cast<const DictionaryArray&>(*result2).dictionary()->Equals(str_array));
+
+  Int32Builder int_builder(default_memory_pool());
+  ASSERT_OK(int_builder.Append(1));
+  ASSERT_OK(int_builder.Append(0));
+  std::shared_ptr<Array> int_array;
+  ASSERT_OK(int_builder.Finish(&int_array));
+  ASSERT_TRUE(static_cast<const DictionaryArray&>(*result2).indices()->Equals(int_array));
+}
+
 TEST(TestStringDictionaryBuilder, DoubleTableSize) {
   // Build the dictionary Array
   StringDictionaryBuilder builder(default_memory_pool());
   // Build expected data
   StringBuilder str_builder(default_memory_pool());
-  UInt16Builder int_builder(default_memory_pool());
+  Int32Builder int_builder(default_memory_pool());
 
   // Fill with 1024 different values
   for (int64_t i = 0; i < 1024; i++) {
@@ -1653,7 +1784,7 @@ TEST(TestStringDictionaryBuilder, DoubleTableSize) {
     ss << "test" << i;
     ASSERT_OK(builder.Append(ss.str()));
     ASSERT_OK(str_builder.Append(ss.str()));
-    ASSERT_OK(int_builder.Append(static_cast<uint16_t>(i)));
+    ASSERT_OK(int_builder.Append(static_cast<int32_t>(i)));
   }
   // Fill with an already existing value
   for (int64_t i = 0; i < 1024; i++) {
@@ -66,6 +66,30 @@ TEST_F(TestBuffer, Resize) {
   ASSERT_EQ(128, buf.capacity());
 }
 
+TEST_F(TestBuffer, ResizeShrinkHysteresis) {
+  PoolBuffer buf;
+
+  ASSERT_OK(buf.Resize(1000));
+  ASSERT_EQ(1024, buf.capacity());
+  const uint8_t* data = buf.data();
+
+  // Shrinking by a little keeps the allocation, so regrowing is free
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_OK(buf.Resize(900, true));
+    ASSERT_EQ(900, buf.size());
+    ASSERT_EQ(1024, buf.capacity());
+    ASSERT_OK(buf.Resize(1000));
+    ASSERT_EQ(1024, buf.capacity());
+    ASSERT_EQ(data, buf.data());
+  }
+
+  // Shrinking to half the capacity or less gives the memory back
+  ASSERT_OK(buf.Resize(512, true));
+  ASSERT_EQ(512, buf.capacity());
+  ASSERT_OK(buf.Resize(0, true));
+  ASSERT_EQ(0, buf.capacity());
+}
+
 TEST_F(TestBuffer, TypedResize) {
   PoolBuffer buf;
 
@@ -185,4 +209,35 @@ TEST_F(TestBuffer, SliceMutableBuffer) {
   ASSERT_TRUE(slice->Equals(expected));
 }
 
+TEST(TestBufferBuilder, GeometricGrowth) {
+  BufferBuilder builder(default_memory_pool());
+  const uint8_t data[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+  ASSERT_OK(builder.Append(data, 10));
+  ASSERT_EQ(64, builder.capacity());
+
+  int num_reallocations = 0;
+  int64_t capacity = builder.capacity();
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_OK(builder.Append(data, 10));
+    if (builder.capacity() != capacity) {
+      ASSERT_GE(builder.capacity(), 2 * capacity);
+      capacity = builder.capacity();
+      ++num_reallocations;
+    }
+  }
+  ASSERT_LE(num_reallocations, 8);
+
+  // Reserve does not change the length
+  ASSERT_OK(builder.Reserve(100000));
+  ASSERT_GE(builder.capacity(), 10010 + 100000);
+  ASSERT_EQ(10010, builder.length());
+
+  // The finished buffer is sized to the appended data
+  std::shared_ptr<Buffer> result;
+  ASSERT_OK(builder.Finish(&result));
+  ASSERT_EQ(10010, result->size());
+  ASSERT_EQ(10, result->data()[10009]);
+}
+
 }  // namespace arrow
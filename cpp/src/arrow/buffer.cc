@@ -91,9 +91,11 @@ Status PoolBuffer::Resize(int64_t new_size, bool shrink_to_fit) {
     RETURN_NOT_OK(Reserve(new_size));
   } else {
     // Buffer is not growing, so shrink to the requested size without
-    // excess space.
+    // excess space. Only shrink once at least half of the capacity would be
+    // given back, so that alternately shrinking and regrowing by small
+    // amounts does not reallocate every time.
     int64_t new_capacity = BitUtil::RoundUpToMultipleOf64(new_size);
-    if (capacity_ != new_capacity) {
+    if (new_capacity < capacity_ && (new_capacity <= capacity_ / 2 || new_size == 0)) {
       // Buffer hasn't got yet the requested size.
       if (new_size == 0) {
         pool_->Free(mutable_data_, capacity_);
@@ -130,7 +130,8 @@ class ARROW_EXPORT ResizableBuffer : public MutableBuffer {
   /// of 64 bytes as defined in Layout.md.
   ///
   /// @param shrink_to_fit On deactivating this option, the capacity of the Buffer won't
-  /// decrease.
+  /// decrease. Implementations may keep the capacity when shrinking would free
+  /// only a small part of it.
   virtual Status Resize(int64_t new_size, bool shrink_to_fit = true) = 0;
 
   /// Ensure that buffer has enough memory allocated to fit the indicated
@@ -185,15 +186,24 @@ class ARROW_EXPORT BufferBuilder {
     return Status::OK();
   }
 
+  /// Ensure that at least additional_bytes more bytes can be appended without
+  /// reallocating. The capacity grows at least geometrically, so that a sequence
+  /// of appends takes amortized linear time.
+  Status Reserve(int64_t additional_bytes) {
+    const int64_t min_capacity = size_ + additional_bytes;
+    if (min_capacity <= capacity_) { return Status::OK(); }
+    return Resize(std::max(min_capacity, capacity_ * 2));
+  }
+
   Status Append(const uint8_t* data, int64_t length) {
-    if (capacity_ < length + size_) { RETURN_NOT_OK(Resize(length + size_)); }
+    if (capacity_ < length + size_) { RETURN_NOT_OK(Reserve(length)); }
     UnsafeAppend(data, length);
     return Status::OK();
   }
 
   // Advance pointer and zero out memory
   Status Advance(int64_t length) {
-    if (capacity_ < length + size_) { RETURN_NOT_OK(Resize(length + size_)); }
+    if (capacity_ < length + size_) { RETURN_NOT_OK(Reserve(length)); }
     memset(data_ + size_, 0, static_cast<size_t>(length));
     size_ += length;
     return Status::OK();
@@ -235,15 +245,23 @@ class ARROW_EXPORT BufferBuilder {
         reinterpret_cast<const uint8_t*>(arithmetic_values), num_elements * sizeof(T));
   }
 
-  std::shared_ptr<Buffer> Finish() {
-    auto result = buffer_;
+  // Advance the length over bytes already written through mutable_data()
+  void UnsafeAdvance(int64_t length) { size_ += length; }
+
+  /// Return the appended data; the buffer keeps any excess capacity
+  Status Finish(std::shared_ptr<Buffer>* out) {
+    if (buffer_ && buffer_->size() > size_) {
+      RETURN_NOT_OK(buffer_->Resize(size_, false));
+    }
+    *out = buffer_;
     buffer_ = nullptr;
     capacity_ = size_ = 0;
-    return result;
+    return Status::OK();
   }
   int64_t capacity() const { return capacity_; }
   int64_t length() const { return size_; }
   const uint8_t* data() const { return data_; }
+  uint8_t* mutable_data() { return data_; }
 
  private:
   std::shared_ptr<PoolBuffer> buffer_;
@@ -156,6 +156,47 @@ static void BM_BuildStringDictionary(
       state.iterations() * iterations * (iterations + 1) / 2 * sizeof(int32_t));
 }
 
+static void BM_BuildBinaryArray(benchmark::State& state) {  // NOLINT non-const reference
+  // 256 MiB of values in total
+  const int64_t iterations = 1 << 24;
+  const std::string value = "1234567890abcdef";
+  while (state.KeepRunning()) {
+    BinaryBuilder builder(default_memory_pool());
+    for (int64_t i = 0; i < iterations; i++) {
+      ABORT_NOT_OK(builder.Append(value));
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * iterations * value.size());
+}
+
+static void BM_BuildBinaryArrayBulk(
+    benchmark::State& state) {  // NOLINT non-const reference
+  // Same values as BM_BuildBinaryArray, appended 1024 rows at a time
+  const int64_t iterations = 1 << 24;
+  const int64_t batch_size = 1 << 10;
+  const std::string value = "1234567890abcdef";
+  std::string data;
+  std::vector<int32_t> offsets(batch_size + 1);
+  for (int64_t i = 0; i < batch_size; i++) {
+    offsets[i] = static_cast<int32_t>(data.size());
+    data += value;
+  }
+  offsets[batch_size] = static_cast<int32_t>(data.size());
+  const auto raw_data = reinterpret_cast<const uint8_t*>(data.data());
+
+  while (state.KeepRunning()) {
+    BinaryBuilder builder(default_memory_pool());
+    for (int64_t i = 0; i < iterations; i += batch_size) {
+      ABORT_NOT_OK(builder.Append(raw_data, offsets.data(), batch_size));
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * iterations * value.size());
+}
+
 BENCHMARK(BM_BuildPrimitiveArrayNoNulls)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_BuildVectorNoNulls)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_BuildAdaptiveIntNoNulls)->Repetitions(3)->Unit(benchmark::kMicrosecond);
@@ -165,5 +206,7 @@ BENCHMARK(BM_BuildAdaptiveIntNoNullsScalarAppend)
 BENCHMARK(BM_BuildAdaptiveUIntNoNulls)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_BuildDictionary)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_BuildStringDictionary)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildBinaryArray)->Repetitions(3)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BuildBinaryArrayBulk)->Repetitions(3)->Unit(benchmark::kMillisecond);
 
 }  // namespace arrow
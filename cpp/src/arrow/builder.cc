@@ -120,29 +120,9 @@ void ArrayBuilder::UnsafeAppendToBitmap(const uint8_t* valid_bytes, int64_t leng
     return;
   }
 
-  int64_t byte_offset = length_ / 8;
-  int64_t bit_offset = length_ % 8;
-  uint8_t bitset = null_bitmap_data_[byte_offset];
-
-  for (int64_t i = 0; i < length; ++i) {
-    if (bit_offset == 8) {
-      bit_offset = 0;
-      null_bitmap_data_[byte_offset] = bitset;
-      byte_offset++;
-      // TODO: Except for the last byte, this shouldn't be needed
-      bitset = null_bitmap_data_[byte_offset];
-    }
-
-    if (valid_bytes[i]) {
-      bitset |= BitUtil::kBitmask[bit_offset];
-    } else {
-      bitset &= BitUtil::kFlippedBitmask[bit_offset];
-      ++null_count_;
-    }
-
-    bit_offset++;
-  }
-  if (bit_offset != 0) { null_bitmap_data_[byte_offset] = bitset; }
+  const int64_t num_valid =
+      BitUtil::BytesToBitmap(valid_bytes, length, null_bitmap_data_, length_);
+  null_count_ += length - num_valid;
   length_ += length;
 }
 
@@ -150,9 +130,9 @@ void ArrayBuilder::UnsafeSetNotNull(int64_t length) {
   const int64_t new_length = length + length_;
 
   // Fill up the bytes until we have a byte alignment
-  int64_t pad_to_byte = 8 - (length_ % 8);
+  int64_t pad_to_byte = std::min<int64_t>(8 - (length_ % 8), length);
   if (pad_to_byte == 8) { pad_to_byte = 0; }
-  for (int64_t i = 0; i < pad_to_byte; ++i) {
+  for (int64_t i = length_; i < length_ + pad_to_byte; ++i) {
     BitUtil::SetBit(null_bitmap_data_, i);
   }
 
@@ -639,6 +619,12 @@ Status BooleanBuilder::Append(
     const uint8_t* values, int64_t length, const uint8_t* valid_bytes) {
   RETURN_NOT_OK(Reserve(length));
 
+  if (valid_bytes == nullptr) {
+    BitUtil::BytesToBitmap(values, length, raw_data_, length_);
+    ArrayBuilder::UnsafeSetNotNull(length);
+    return Status::OK();
+  }
+
   for (int64_t i = 0; i < length; ++i) {
     // Skip reading from unitialised memory
     // TODO: This actually is only to keep valgrind happy but may or may not
@@ -700,10 +686,11 @@ template <typename T>
 Status DictionaryBuilder<T>::Finish(std::shared_ptr<Array>* out) {
   std::shared_ptr<Array> dictionary;
   RETURN_NOT_OK(dict_builder_.Finish(&dictionary));
-  auto type = std::make_shared<DictionaryType>(type_, dictionary);
+  RETURN_NOT_OK(RetainDictionary(*dictionary));
 
   std::shared_ptr<Array> values;
   RETURN_NOT_OK(values_builder_.Finish(&values));
+  auto type = std::make_shared<DictionaryType>(int32(), dictionary);
 
   *out = std::make_shared<DictionaryArray>(type, values);
   return Status::OK();
@@ -823,6 +810,14 @@ Status DictionaryBuilder<T>::AppendDictionary(const Scalar& value) {
   return dict_builder_.Append(value);
 }
 
+// Put the finished entries back in dict_builder_, where the hash slots refer
+// to them
+template <typename T>
+Status DictionaryBuilder<T>::RetainDictionary(const Array& dictionary) {
+  const auto& values = static_cast<const NumericArray<T>&>(dictionary);
+  return dict_builder_.Append(values.raw_data(), values.length());
+}
+
 #define BINARY_DICTIONARY_SPECIALIZATIONS(Type)                                        \
   template <>                                                                          \
   internal::WrappedBinary DictionaryBuilder<Type>::GetDictionaryValue(int64_t index) { \
@@ -853,6 +848,17 @@ Status DictionaryBuilder<T>::AppendDictionary(const Scalar& value) {
   }                                                                                    \
                                                                                        \
   template <>                                                                          \
+  Status DictionaryBuilder<Type>::RetainDictionary(const Array& dictionary) {          \
+    const BinaryArray& binary_array = static_cast<const BinaryArray&>(dictionary);     \
+    int32_t length;                                                                    \
+    for (int64_t i = 0; i < dictionary.length(); i++) {                                \
+      const uint8_t* value = binary_array.GetValue(i, &length);                        \
+      RETURN_NOT_OK(dict_builder_.Append(value, length));                              \
+    }                                                                                  \
+    return Status::OK();                                                               \
+  }                                                                                    \
+                                                                                       \
+  template <>                                                                          \
   int DictionaryBuilder<Type>::HashValue(const internal::WrappedBinary& value) {       \
     return HashUtil::Hash(value.ptr_, value.length_, 0);                               \
   }                                                                                    \
@@ -957,7 +963,8 @@ Status DecimalBuilder::Resize(int64_t capacity) {
 }
 
 Status DecimalBuilder::Finish(std::shared_ptr<Array>* out) {
-  std::shared_ptr<Buffer> data = byte_builder_.Finish();
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(byte_builder_.Finish(&data));
 
   /// TODO(phillipc): not sure where to get the offset argument here
   *out = std::make_shared<DecimalArray>(
@@ -1018,7 +1025,8 @@ Status ListBuilder::Finish(std::shared_ptr<Array>* out) {
   if (!items) { RETURN_NOT_OK(value_builder_->Finish(&items)); }
 
   RETURN_NOT_OK(offset_builder_.Append<int64_t>(items->length()));
-  std::shared_ptr<Buffer> offsets = offset_builder_.Finish();
+  std::shared_ptr<Buffer> offsets;
+  RETURN_NOT_OK(offset_builder_.Finish(&offsets));
 
   *out = std::make_shared<ListArray>(
       type_, length_, offsets, items, null_bitmap_, null_count_);
@@ -1053,6 +1061,65 @@ BinaryBuilder::BinaryBuilder(MemoryPool* pool, const std::shared_ptr<DataType>&
   byte_builder_ = static_cast<UInt8Builder*>(value_builder_.get());
 }
 
+Status BinaryBuilder::Append(const uint8_t* data, const int32_t* offsets,
+    int64_t length, const uint8_t* valid_bytes) {
+  if (length == 0) { return Status::OK(); }
+  const int64_t value_offset = byte_builder_->length();
+  const int64_t nbytes = offsets[length] - offsets[0];
+  if (value_offset + nbytes > std::numeric_limits<int32_t>::max()) {
+    return Status::Invalid("BinaryBuilder cannot hold more than 2^31 - 1 bytes");
+  }
+
+  // Reserving also sizes offset_builder_ for length more offsets
+  RETURN_NOT_OK(Reserve(length));
+  RETURN_NOT_OK(byte_builder_->Append(data + offsets[0], nbytes));
+  UnsafeAppendToBitmap(valid_bytes, length);
+
+  const int32_t delta = static_cast<int32_t>(value_offset) - offsets[0];
+  int32_t* out_offsets = reinterpret_cast<int32_t*>(
+      offset_builder_.mutable_data() + offset_builder_.length());
+  for (int64_t i = 0; i < length; ++i) {
+    out_offsets[i] = offsets[i] + delta;
+  }
+  offset_builder_.UnsafeAdvance(length * sizeof(int32_t));
+  return Status::OK();
+}
+
+Status BinaryBuilder::Append(
+    const std::vector<std::pair<const uint8_t*, int32_t>>& values,
+    const uint8_t* valid_bytes) {
+  const int64_t length = static_cast<int64_t>(values.size());
+  if (length == 0) { return Status::OK(); }
+  const int64_t value_offset = byte_builder_->length();
+  int64_t nbytes = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    if (valid_bytes == nullptr || valid_bytes[i]) { nbytes += values[i].second; }
+  }
+  if (value_offset + nbytes > std::numeric_limits<int32_t>::max()) {
+    return Status::Invalid("BinaryBuilder cannot hold more than 2^31 - 1 bytes");
+  }
+
+  RETURN_NOT_OK(Reserve(length));
+  RETURN_NOT_OK(byte_builder_->Reserve(nbytes));
+  UnsafeAppendToBitmap(valid_bytes, length);
+
+  // Gather the values straight into the byte builder's buffer
+  uint8_t* out_data = nbytes > 0 ? byte_builder_->data()->mutable_data() : nullptr;
+  int32_t* out_offsets = reinterpret_cast<int32_t*>(
+      offset_builder_.mutable_data() + offset_builder_.length());
+  int32_t position = static_cast<int32_t>(value_offset);
+  for (int64_t i = 0; i < length; ++i) {
+    out_offsets[i] = position;
+    if (valid_bytes == nullptr || valid_bytes[i]) {
+      std::memcpy(out_data + position, values[i].first,
+          static_cast<size_t>(values[i].second));
+      position += values[i].second;
+    }
+  }
+  offset_builder_.UnsafeAdvance(length * sizeof(int32_t));
+  return byte_builder_->SetNotNull(nbytes);
+}
+
 Status BinaryBuilder::Finish(std::shared_ptr<Array>* out) {
   std::shared_ptr<Array> result;
   RETURN_NOT_OK(ListBuilder::Finish(&result));
@@ -1135,7 +1202,8 @@ Status FixedSizeBinaryBuilder::Resize(int64_t capacity) {
 }
 
 Status FixedSizeBinaryBuilder::Finish(std::shared_ptr<Array>* out) {
-  std::shared_ptr<Buffer> data = byte_builder_.Finish();
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(byte_builder_.Finish(&data));
   *out = std::make_shared<FixedSizeBinaryArray>(
       type_, length_, data, null_bitmap_, null_count_);
   return Status::OK();
@@ -23,6 +23,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "arrow/buffer.h"
@@ -567,6 +568,24 @@ class ARROW_EXPORT BinaryBuilder : public ListBuilder {
     return Append(value.c_str(), static_cast<int32_t>(value.size()));
   }
 
+  /// \brief Append many values laid out contiguously
+  ///
+  /// Value i is the byte range [offsets[i], offsets[i + 1]) of data, so offsets
+  /// must have length + 1 entries. The bytes are copied in a single block and the
+  /// offsets are rebased onto the end of the builder's data.
+  ///
+  /// If passed, valid_bytes is of equal length to values, and any zero byte
+  /// will be considered as a null for that slot
+  Status Append(const uint8_t* data, const int32_t* offsets, int64_t length,
+      const uint8_t* valid_bytes = nullptr);
+
+  /// \brief Append many values given as (pointer, length) pairs
+  ///
+  /// The values of null slots are not read. If passed, valid_bytes is of equal
+  /// length to values, and any zero byte will be considered as a null for that slot
+  Status Append(const std::vector<std::pair<const uint8_t*, int32_t>>& values,
+      const uint8_t* valid_bytes = nullptr);
+
   Status Finish(std::shared_ptr<Array>* out) override;
 
   /// Temporary access to a value.
@@ -717,6 +736,12 @@ struct DictionaryScalar<StringType> {
 
 /// \brief Array builder for created encoded DictionaryArray from dense array
 /// data
+///
+/// The dictionary is kept across calls to Finish, so the dictionary of each
+/// array built starts with the entries of the previous one
+///
+/// The indices are int32 whatever the size of the dictionary, so that the
+/// arrays built all have the same index type
 template <typename T>
 class ARROW_EXPORT DictionaryBuilder : public ArrayBuilder {
  public:
@@ -747,6 +772,7 @@ class ARROW_EXPORT DictionaryBuilder : public ArrayBuilder {
   int HashValue(const Scalar& value);
   bool SlotDifferent(hash_slot_t slot, const Scalar& value);
   Status AppendDictionary(const Scalar& value);
+  Status RetainDictionary(const Array& dictionary);
 
   std::shared_ptr<PoolBuffer> hash_table_;
   int32_t* hash_slots_;
@@ -759,7 +785,7 @@ class ARROW_EXPORT DictionaryBuilder : public ArrayBuilder {
   int mod_bitmask_;
 
   typename TypeTraits<T>::BuilderType dict_builder_;
-  AdaptiveUIntBuilder values_builder_;
+  Int32Builder values_builder_;
 };
 
 class ARROW_EXPORT BinaryDictionaryBuilder : public DictionaryBuilder<BinaryType> {
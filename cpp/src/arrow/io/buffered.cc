@@ -0,0 +1,232 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/buffered.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace io {
+
+static constexpr int64_t kDefaultBufferSize = 1 << 16;
+
+// ----------------------------------------------------------------------
+// BufferedOutputStream
+
+BufferedOutputStream::BufferedOutputStream(const std::shared_ptr<OutputStream>& raw)
+    : raw_(raw),
+      buffer_data_(nullptr),
+      buffer_size_(0),
+      buffer_pos_(0),
+      raw_pos_(0),
+      is_open_(true) {}
+
+BufferedOutputStream::~BufferedOutputStream() {
+  // This can fail, better to explicitly call close or flush
+  if (is_open_) { DCHECK(FlushBuffer().ok()); }
+}
+
+Status BufferedOutputStream::Create(const std::shared_ptr<OutputStream>& raw,
+    std::shared_ptr<BufferedOutputStream>* out) {
+  return Create(raw, kDefaultBufferSize, default_memory_pool(), out);
+}
+
+Status BufferedOutputStream::Create(const std::shared_ptr<OutputStream>& raw,
+    int64_t buffer_size, MemoryPool* pool, std::shared_ptr<BufferedOutputStream>* out) {
+  if (buffer_size <= 0) { return Status::Invalid("Buffer size must be positive"); }
+
+  std::shared_ptr<BufferedOutputStream> result(new BufferedOutputStream(raw));
+  RETURN_NOT_OK(AllocateResizableBuffer(pool, buffer_size, &result->buffer_));
+  result->buffer_data_ = result->buffer_->mutable_data();
+  result->buffer_size_ = buffer_size;
+  RETURN_NOT_OK(raw->Tell(&result->raw_pos_));
+
+  *out = result;
+  return Status::OK();
+}
+
+Status BufferedOutputStream::Close() {
+  if (is_open_) {
+    RETURN_NOT_OK(FlushBuffer());
+    is_open_ = false;
+    return raw_->Close();
+  }
+  return Status::OK();
+}
+
+Status BufferedOutputStream::Tell(int64_t* position) {
+  *position = raw_pos_ + buffer_pos_;
+  return Status::OK();
+}
+
+Status BufferedOutputStream::Write(const uint8_t* data, int64_t nbytes) {
+  if (buffer_pos_ + nbytes <= buffer_size_) {
+    std::memcpy(buffer_data_ + buffer_pos_, data, static_cast<size_t>(nbytes));
+    buffer_pos_ += nbytes;
+    if (buffer_pos_ == buffer_size_) { return FlushBuffer(); }
+    return Status::OK();
+  }
+
+  RETURN_NOT_OK(FlushBuffer());
+  if (nbytes >= buffer_size_) {
+    // Large writes gain nothing from another copy
+    RETURN_NOT_OK(raw_->Write(data, nbytes));
+    raw_pos_ += nbytes;
+  } else {
+    std::memcpy(buffer_data_, data, static_cast<size_t>(nbytes));
+    buffer_pos_ = nbytes;
+  }
+  return Status::OK();
+}
+
+Status BufferedOutputStream::Writev(
+    const std::vector<std::shared_ptr<Buffer>>& buffers) {
+  int64_t total = 0;
+  for (const auto& buffer : buffers) {
+    total += buffer->size();
+  }
+  if (buffer_pos_ + total <= buffer_size_) {
+    for (const auto& buffer : buffers) {
+      std::memcpy(buffer_data_ + buffer_pos_, buffer->data(),
+          static_cast<size_t>(buffer->size()));
+      buffer_pos_ += buffer->size();
+    }
+    if (buffer_pos_ == buffer_size_) { return FlushBuffer(); }
+    return Status::OK();
+  }
+
+  std::vector<std::shared_ptr<Buffer>> gathered;
+  gathered.reserve(buffers.size() + 1);
+  if (buffer_pos_ > 0) { gathered.push_back(SliceBuffer(buffer_, 0, buffer_pos_)); }
+  gathered.insert(gathered.end(), buffers.begin(), buffers.end());
+  RETURN_NOT_OK(raw_->Writev(gathered));
+  raw_pos_ += buffer_pos_ + total;
+  buffer_pos_ = 0;
+  return Status::OK();
+}
+
+Status BufferedOutputStream::Flush() {
+  RETURN_NOT_OK(FlushBuffer());
+  return raw_->Flush();
+}
+
+Status BufferedOutputStream::FlushBuffer() {
+  if (buffer_pos_ > 0) {
+    RETURN_NOT_OK(raw_->Write(buffer_data_, buffer_pos_));
+    raw_pos_ += buffer_pos_;
+    buffer_pos_ = 0;
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// BufferedInputStream
+
+BufferedInputStream::BufferedInputStream(
+    const std::shared_ptr<InputStream>& raw, MemoryPool* pool)
+    : raw_(raw),
+      pool_(pool),
+      buffer_data_(nullptr),
+      buffer_size_(0),
+      buffer_pos_(0),
+      buffer_end_(0),
+      raw_pos_(0) {}
+
+BufferedInputStream::~BufferedInputStream() {}
+
+Status BufferedInputStream::Create(const std::shared_ptr<InputStream>& raw,
+    std::shared_ptr<BufferedInputStream>* out) {
+  return Create(raw, kDefaultBufferSize, default_memory_pool(), out);
+}
+
+Status BufferedInputStream::Create(const std::shared_ptr<InputStream>& raw,
+    int64_t buffer_size, MemoryPool* pool, std::shared_ptr<BufferedInputStream>* out) {
+  if (buffer_size <= 0) { return Status::Invalid("Buffer size must be positive"); }
+
+  std::shared_ptr<BufferedInputStream> result(new BufferedInputStream(raw, pool));
+  RETURN_NOT_OK(AllocateResizableBuffer(pool, buffer_size, &result->buffer_));
+  result->buffer_data_ = result->buffer_->mutable_data();
+  result->buffer_size_ = buffer_size;
+  RETURN_NOT_OK(raw->Tell(&result->raw_pos_));
+
+  *out = result;
+  return Status::OK();
+}
+
+Status BufferedInputStream::Close() {
+  buffer_pos_ = buffer_end_ = 0;
+  return raw_->Close();
+}
+
+Status BufferedInputStream::Tell(int64_t* position) {
+  *position = raw_pos_ - bytes_buffered();
+  return Status::OK();
+}
+
+Status BufferedInputStream::Read(int64_t nbytes, int64_t* bytes_read, uint8_t* out) {
+  *bytes_read = 0;
+  while (*bytes_read < nbytes) {
+    const int64_t remaining = nbytes - *bytes_read;
+
+    if (buffer_pos_ == buffer_end_) {
+      int64_t nread = 0;
+      if (remaining >= buffer_size_) {
+        // Large reads go directly into the destination
+        RETURN_NOT_OK(raw_->Read(remaining, &nread, out + *bytes_read));
+        raw_pos_ += nread;
+        *bytes_read += nread;
+        if (nread == 0) { break; }
+        continue;
+      }
+      RETURN_NOT_OK(raw_->Read(buffer_size_, &nread, buffer_data_));
+      raw_pos_ += nread;
+      buffer_pos_ = 0;
+      buffer_end_ = nread;
+      if (nread == 0) { break; }
+    }
+
+    const int64_t ncopy = std::min(remaining, buffer_end_ - buffer_pos_);
+    std::memcpy(
+        out + *bytes_read, buffer_data_ + buffer_pos_, static_cast<size_t>(ncopy));
+    buffer_pos_ += ncopy;
+    *bytes_read += ncopy;
+  }
+  return Status::OK();
+}
+
+Status BufferedInputStream::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  std::shared_ptr<ResizableBuffer> buffer;
+  RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buffer));
+
+  int64_t bytes_read = 0;
+  RETURN_NOT_OK(Read(nbytes, &bytes_read, buffer->mutable_data()));
+  if (bytes_read < nbytes) { RETURN_NOT_OK(buffer->Resize(bytes_read)); }
+  *out = buffer;
+  return Status::OK();
+}
+
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,143 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Buffered stream wrappers that coalesce small reads and writes
+
+#ifndef ARROW_IO_BUFFERED_H
+#define ARROW_IO_BUFFERED_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class MemoryPool;
+class ResizableBuffer;
+class Status;
+
+namespace io {
+
+/// \brief An OutputStream that collects small writes in a fixed-size buffer
+/// and forwards them to the wrapped stream in one Write when the buffer fills.
+/// Writes at least as large as the buffer are passed straight through after
+/// flushing. Not thread-safe
+class ARROW_EXPORT BufferedOutputStream : public OutputStream {
+ public:
+  ~BufferedOutputStream();
+
+  /// Wrap a stream with a 64KB buffer allocated from the default memory pool
+  static Status Create(const std::shared_ptr<OutputStream>& raw,
+      std::shared_ptr<BufferedOutputStream>* out);
+
+  /// \param[in] raw the stream to write to
+  /// \param[in] buffer_size the number of bytes to collect before writing
+  /// \param[in] pool the memory pool to allocate the buffer from
+  /// \param[out] out the buffered stream
+  static Status Create(const std::shared_ptr<OutputStream>& raw, int64_t buffer_size,
+      MemoryPool* pool, std::shared_ptr<BufferedOutputStream>* out);
+
+  /// Flush buffered data and close the wrapped stream
+  Status Close() override;
+  Status Tell(int64_t* position) override;
+  Status Write(const uint8_t* data, int64_t nbytes) override;
+  using Writeable::Write;
+
+  /// Buffer the data if it fits, otherwise pass it with the buffered data to
+  /// the wrapped stream as one gathered write
+  Status Writev(const std::vector<std::shared_ptr<Buffer>>& buffers) override;
+
+  /// Write out buffered data and flush the wrapped stream
+  Status Flush() override;
+
+  std::shared_ptr<OutputStream> raw() const { return raw_; }
+  int64_t buffer_size() const { return buffer_size_; }
+
+ private:
+  explicit BufferedOutputStream(const std::shared_ptr<OutputStream>& raw);
+
+  // Write out buffered data without flushing the wrapped stream
+  Status FlushBuffer();
+
+  std::shared_ptr<OutputStream> raw_;
+  std::shared_ptr<ResizableBuffer> buffer_;
+  uint8_t* buffer_data_;
+  int64_t buffer_size_;
+  int64_t buffer_pos_;
+
+  // Position of the wrapped stream, excluding buffered data
+  int64_t raw_pos_;
+  bool is_open_;
+};
+
+/// \brief An InputStream that serves small reads from a fixed-size buffer,
+/// refilled with one Read of the wrapped stream when exhausted. Reads at
+/// least as large as the buffer are passed straight through once buffered
+/// data is consumed. Not thread-safe
+class ARROW_EXPORT BufferedInputStream : public InputStream {
+ public:
+  ~BufferedInputStream();
+
+  /// Wrap a stream with a 64KB buffer allocated from the default memory pool
+  static Status Create(const std::shared_ptr<InputStream>& raw,
+      std::shared_ptr<BufferedInputStream>* out);
+
+  /// \param[in] raw the stream to read from
+  /// \param[in] buffer_size the number of bytes to read ahead
+  /// \param[in] pool the memory pool for the buffer and for returned Buffers
+  /// \param[out] out the buffered stream
+  static Status Create(const std::shared_ptr<InputStream>& raw, int64_t buffer_size,
+      MemoryPool* pool, std::shared_ptr<BufferedInputStream>* out);
+
+  /// Close the wrapped stream
+  Status Close() override;
+  Status Tell(int64_t* position) override;
+
+  /// Read until nbytes have been read or the wrapped stream is exhausted
+  Status Read(int64_t nbytes, int64_t* bytes_read, uint8_t* out) override;
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  std::shared_ptr<InputStream> raw() const { return raw_; }
+  int64_t buffer_size() const { return buffer_size_; }
+
+  /// Number of bytes read from the wrapped stream but not yet consumed
+  int64_t bytes_buffered() const { return buffer_end_ - buffer_pos_; }
+
+ private:
+  BufferedInputStream(const std::shared_ptr<InputStream>& raw, MemoryPool* pool);
+
+  std::shared_ptr<InputStream> raw_;
+  MemoryPool* pool_;
+  std::shared_ptr<ResizableBuffer> buffer_;
+  uint8_t* buffer_data_;
+  int64_t buffer_size_;
+  int64_t buffer_pos_;
+  int64_t buffer_end_;
+
+  // Position of the wrapped stream, including buffered data
+  int64_t raw_pos_;
+};
+
+}  // namespace io
+}  // namespace arrow
+
+#endif  // ARROW_IO_BUFFERED_H
@@ -0,0 +1,360 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/compressed.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace io {
+
+static constexpr int64_t kDefaultBlockSize = 1 << 20;
+
+// Uncompressed and compressed lengths of the frame
+static constexpr int64_t kFrameHeaderSize = 2 * sizeof(int32_t);
+
+static Status MakeCodec(Compression::type compression, std::unique_ptr<Codec>* codec) {
+  RETURN_NOT_OK(Codec::Create(compression, codec));
+  if (!*codec) { return Status::Invalid("A compressed stream requires a codec"); }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// CompressedOutputStream implementation
+
+class CompressedOutputStream::CompressedOutputStreamImpl {
+ public:
+  CompressedOutputStreamImpl(
+      const std::shared_ptr<OutputStream>& raw, int64_t block_size, MemoryPool* pool)
+      : raw_(raw),
+        block_size_(block_size),
+        pool_(pool),
+        block_pos_(0),
+        position_(0),
+        is_open_(true) {}
+
+  ~CompressedOutputStreamImpl() {
+    // This can fail, better to explicitly call close or flush
+    if (is_open_) { DCHECK(CompressBlock().ok()); }
+  }
+
+  Status Init(Compression::type compression) {
+    RETURN_NOT_OK(MakeCodec(compression, &codec_));
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, block_size_, &block_));
+    return AllocateResizableBuffer(pool_, 0, &frame_);
+  }
+
+  Status Close() {
+    if (is_open_) {
+      RETURN_NOT_OK(CompressBlock());
+      is_open_ = false;
+      return raw_->Close();
+    }
+    return Status::OK();
+  }
+
+  int64_t position() const { return position_; }
+
+  Status Write(const uint8_t* data, int64_t nbytes) {
+    while (nbytes > 0) {
+      const int64_t ncopy = std::min(nbytes, block_size_ - block_pos_);
+      std::memcpy(block_->mutable_data() + block_pos_, data, static_cast<size_t>(ncopy));
+      block_pos_ += ncopy;
+      position_ += ncopy;
+      data += ncopy;
+      nbytes -= ncopy;
+      if (block_pos_ == block_size_) { RETURN_NOT_OK(CompressBlock()); }
+    }
+    return Status::OK();
+  }
+
+  Status Flush() {
+    RETURN_NOT_OK(CompressBlock());
+    return raw_->Flush();
+  }
+
+  std::shared_ptr<OutputStream> raw() const { return raw_; }
+
+ private:
+  // Compress the buffered data into a frame and write it out in one Write
+  Status CompressBlock() {
+    if (block_pos_ == 0) { return Status::OK(); }
+
+    const int64_t max_length = codec_->MaxCompressedLen(block_pos_, block_->data());
+    if (frame_->size() < kFrameHeaderSize + max_length) {
+      RETURN_NOT_OK(frame_->Resize(kFrameHeaderSize + max_length));
+    }
+
+    int64_t compressed_length;
+    RETURN_NOT_OK(codec_->Compress(block_pos_, block_->data(), max_length,
+        frame_->mutable_data() + kFrameHeaderSize, &compressed_length));
+    if (compressed_length > std::numeric_limits<int32_t>::max()) {
+      return Status::Invalid("Compressed block is too large for a frame");
+    }
+
+    const int32_t lengths[2] = {
+        static_cast<int32_t>(block_pos_), static_cast<int32_t>(compressed_length)};
+    std::memcpy(frame_->mutable_data(), lengths, sizeof(lengths));
+    RETURN_NOT_OK(raw_->Write(frame_->data(), kFrameHeaderSize + compressed_length));
+    block_pos_ = 0;
+    return Status::OK();
+  }
+
+  std::shared_ptr<OutputStream> raw_;
+  std::unique_ptr<Codec> codec_;
+  int64_t block_size_;
+  MemoryPool* pool_;
+
+  // Uncompressed data not yet written
+  std::shared_ptr<ResizableBuffer> block_;
+  int64_t block_pos_;
+
+  // Scratch space for the frame being written
+  std::shared_ptr<ResizableBuffer> frame_;
+
+  int64_t position_;
+  bool is_open_;
+};
+
+CompressedOutputStream::CompressedOutputStream() {}
+
+CompressedOutputStream::~CompressedOutputStream() {}
+
+Status CompressedOutputStream::Create(Compression::type compression,
+    const std::shared_ptr<OutputStream>& raw,
+    std::shared_ptr<CompressedOutputStream>* out) {
+  return Create(compression, raw, kDefaultBlockSize, default_memory_pool(), out);
+}
+
+Status CompressedOutputStream::Create(Compression::type compression,
+    const std::shared_ptr<OutputStream>& raw, int64_t block_size, MemoryPool* pool,
+    std::shared_ptr<CompressedOutputStream>* out) {
+  if (block_size <= 0 || block_size > std::numeric_limits<int32_t>::max()) {
+    return Status::Invalid("Block size must be positive and fit in an int32");
+  }
+
+  std::shared_ptr<CompressedOutputStream> result(new CompressedOutputStream());
+  result->impl_.reset(new CompressedOutputStreamImpl(raw, block_size, pool));
+  RETURN_NOT_OK(result->impl_->Init(compression));
+  *out = result;
+  return Status::OK();
+}
+
+Status CompressedOutputStream::Close() {
+  return impl_->Close();
+}
+
+Status CompressedOutputStream::Tell(int64_t* position) {
+  *position = impl_->position();
+  return Status::OK();
+}
+
+Status CompressedOutputStream::Write(const uint8_t* data, int64_t nbytes) {
+  return impl_->Write(data, nbytes);
+}
+
+Status CompressedOutputStream::Flush() {
+  return impl_->Flush();
+}
+
+std::shared_ptr<OutputStream> CompressedOutputStream::raw() const {
+  return impl_->raw();
+}
+
+// ----------------------------------------------------------------------
+// CompressedInputStream implementation
+
+// Read nbytes unless the stream ends first, without copying if the stream
+// returns them all at once
+static Status ReadFully(InputStream* raw, int64_t nbytes, MemoryPool* pool,
+    std::shared_ptr<Buffer>* out) {
+  RETURN_NOT_OK(raw->Read(nbytes, out));
+  int64_t total = (*out)->size();
+  if (total == nbytes || total == 0) { return Status::OK(); }
+
+  std::shared_ptr<ResizableBuffer> buffer;
+  RETURN_NOT_OK(AllocateResizableBuffer(pool, nbytes, &buffer));
+  std::memcpy(buffer->mutable_data(), (*out)->data(), static_cast<size_t>(total));
+  while (total < nbytes) {
+    int64_t bytes_read;
+    RETURN_NOT_OK(raw->Read(nbytes - total, &bytes_read, buffer->mutable_data() + total));
+    if (bytes_read == 0) { break; }
+    total += bytes_read;
+  }
+  RETURN_NOT_OK(buffer->Resize(total));
+  *out = buffer;
+  return Status::OK();
+}
+
+class CompressedInputStream::CompressedInputStreamImpl {
+ public:
+  CompressedInputStreamImpl(const std::shared_ptr<InputStream>& raw, MemoryPool* pool)
+      : raw_(raw), pool_(pool), block_pos_(0), position_(0) {}
+
+  Status Init(Compression::type compression) { return MakeCodec(compression, &codec_); }
+
+  Status Close() {
+    block_.reset();
+    return raw_->Close();
+  }
+
+  int64_t position() const { return position_; }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, uint8_t* out) {
+    *bytes_read = 0;
+    while (*bytes_read < nbytes) {
+      bool eof;
+      RETURN_NOT_OK(FetchBlock(&eof));
+      if (eof) { break; }
+      const int64_t ncopy = std::min(nbytes - *bytes_read, block_remaining());
+      std::memcpy(
+          out + *bytes_read, block_->data() + block_pos_, static_cast<size_t>(ncopy));
+      Advance(ncopy);
+      *bytes_read += ncopy;
+    }
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    bool eof;
+    RETURN_NOT_OK(FetchBlock(&eof));
+    if (eof) {
+      *out = std::make_shared<Buffer>(nullptr, 0);
+      return Status::OK();
+    }
+    if (nbytes <= block_remaining()) {
+      *out = SliceBuffer(block_, block_pos_, nbytes);
+      Advance(nbytes);
+      return Status::OK();
+    }
+
+    // Spans several blocks, so must be copied
+    std::shared_ptr<ResizableBuffer> buffer;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buffer));
+    int64_t bytes_read = 0;
+    RETURN_NOT_OK(Read(nbytes, &bytes_read, buffer->mutable_data()));
+    if (bytes_read < nbytes) { RETURN_NOT_OK(buffer->Resize(bytes_read)); }
+    *out = buffer;
+    return Status::OK();
+  }
+
+  std::shared_ptr<InputStream> raw() const { return raw_; }
+
+ private:
+  int64_t block_remaining() const { return block_ ? block_->size() - block_pos_ : 0; }
+
+  void Advance(int64_t nbytes) {
+    block_pos_ += nbytes;
+    position_ += nbytes;
+  }
+
+  // Make sure block_ has unread bytes, decompressing the next frame if needed
+  Status FetchBlock(bool* eof) {
+    *eof = false;
+    if (block_remaining() > 0) { return Status::OK(); }
+
+    std::shared_ptr<Buffer> header;
+    RETURN_NOT_OK(ReadFully(raw_.get(), kFrameHeaderSize, pool_, &header));
+    if (header->size() == 0) {
+      *eof = true;
+      block_.reset();
+      return Status::OK();
+    }
+    if (header->size() < kFrameHeaderSize) {
+      return Status::IOError("Compressed stream ended within a frame header");
+    }
+
+    int32_t lengths[2];
+    std::memcpy(lengths, header->data(), sizeof(lengths));
+    const int64_t uncompressed_length = lengths[0];
+    const int64_t compressed_length = lengths[1];
+    if (uncompressed_length < 0 || compressed_length < 0) {
+      return Status::IOError("Invalid compressed frame header");
+    }
+
+    std::shared_ptr<Buffer> compressed;
+    RETURN_NOT_OK(ReadFully(raw_.get(), compressed_length, pool_, &compressed));
+    if (compressed->size() < compressed_length) {
+      return Status::IOError("Compressed stream ended within a frame");
+    }
+
+    std::shared_ptr<MutableBuffer> block;
+    RETURN_NOT_OK(AllocateBuffer(pool_, uncompressed_length, &block));
+    RETURN_NOT_OK(codec_->Decompress(compressed_length, compressed->data(),
+        uncompressed_length, block->mutable_data()));
+    block_ = block;
+    block_pos_ = 0;
+    return Status::OK();
+  }
+
+  std::shared_ptr<InputStream> raw_;
+  std::unique_ptr<Codec> codec_;
+  MemoryPool* pool_;
+
+  // The current decompressed block. A new one is allocated for each frame,
+  // as Buffers sliced from the previous one may still be alive
+  std::shared_ptr<Buffer> block_;
+  int64_t block_pos_;
+  int64_t position_;
+};
+
+CompressedInputStream::CompressedInputStream() {}
+
+CompressedInputStream::~CompressedInputStream() {}
+
+Status CompressedInputStream::Create(Compression::type compression,
+    const std::shared_ptr<InputStream>& raw, MemoryPool* pool,
+    std::shared_ptr<CompressedInputStream>* out) {
+  std::shared_ptr<CompressedInputStream> result(new CompressedInputStream());
+  result->impl_.reset(new CompressedInputStreamImpl(raw, pool));
+  RETURN_NOT_OK(result->impl_->Init(compression));
+  *out = result;
+  return Status::OK();
+}
+
+Status CompressedInputStream::Close() {
+  return impl_->Close();
+}
+
+Status CompressedInputStream::Tell(int64_t* position) {
+  *position = impl_->position();
+  return Status::OK();
+}
+
+Status CompressedInputStream::Read(int64_t nbytes, int64_t* bytes_read, uint8_t* out) {
+  return impl_->Read(nbytes, bytes_read, out);
+}
+
+Status CompressedInputStream::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  return impl_->Read(nbytes, out);
+}
+
+std::shared_ptr<InputStream> CompressedInputStream::raw() const {
+  return impl_->raw();
+}
+
+}  // namespace io
+}  // namespace arrow
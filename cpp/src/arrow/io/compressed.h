@@ -0,0 +1,126 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Streams that compress or decompress data written to or read from another
+// stream, using the codecs in arrow/util/compression.h
+
+#ifndef ARROW_IO_COMPRESSED_H
+#define ARROW_IO_COMPRESSED_H
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class MemoryPool;
+class Status;
+
+namespace io {
+
+/// \brief An OutputStream that compresses the data written to it in blocks
+/// and writes them to the wrapped stream as frames.
+///
+/// Each frame is the uncompressed and compressed lengths as int32, followed by
+/// the output of Codec::Compress for the block. Frames are independent, so a
+/// stream can be read back with CompressedInputStream as soon as it is
+/// flushed. Not thread-safe
+class ARROW_EXPORT CompressedOutputStream : public OutputStream {
+ public:
+  ~CompressedOutputStream();
+
+  /// Compress in blocks of 1MB, allocated from the default memory pool
+  static Status Create(Compression::type compression,
+      const std::shared_ptr<OutputStream>& raw,
+      std::shared_ptr<CompressedOutputStream>* out);
+
+  /// \param[in] compression the codec to compress with
+  /// \param[in] raw the stream to write the frames to
+  /// \param[in] block_size the number of bytes compressed into each frame
+  /// \param[in] pool the memory pool for the block buffers
+  /// \param[out] out the compressed stream
+  static Status Create(Compression::type compression,
+      const std::shared_ptr<OutputStream>& raw, int64_t block_size, MemoryPool* pool,
+      std::shared_ptr<CompressedOutputStream>* out);
+
+  /// Compress any buffered data and close the wrapped stream
+  Status Close() override;
+
+  /// The number of uncompressed bytes written
+  Status Tell(int64_t* position) override;
+
+  Status Write(const uint8_t* data, int64_t nbytes) override;
+  using Writeable::Write;
+
+  /// Compress the buffered data into a frame, even if the block is not full,
+  /// and flush the wrapped stream
+  Status Flush() override;
+
+  std::shared_ptr<OutputStream> raw() const;
+
+ private:
+  CompressedOutputStream();
+
+  class ARROW_NO_EXPORT CompressedOutputStreamImpl;
+  std::unique_ptr<CompressedOutputStreamImpl> impl_;
+};
+
+/// \brief An InputStream that decompresses the frames written by
+/// CompressedOutputStream as they are read from the wrapped stream.
+///
+/// Reads within one decompressed block are zero-copy slices of it. Not
+/// thread-safe
+class ARROW_EXPORT CompressedInputStream : public InputStream {
+ public:
+  ~CompressedInputStream();
+
+  /// \param[in] compression the codec the frames were compressed with
+  /// \param[in] raw the stream to read the frames from
+  /// \param[in] pool the memory pool for decompressed blocks
+  /// \param[out] out the decompressing stream
+  static Status Create(Compression::type compression,
+      const std::shared_ptr<InputStream>& raw, MemoryPool* pool,
+      std::shared_ptr<CompressedInputStream>* out);
+
+  Status Close() override;
+
+  /// The number of uncompressed bytes read
+  Status Tell(int64_t* position) override;
+
+  /// Read until nbytes have been read or the wrapped stream is exhausted.
+  /// Returns IOError if the wrapped stream ends within a frame
+  Status Read(int64_t nbytes, int64_t* bytes_read, uint8_t* out) override;
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  std::shared_ptr<InputStream> raw() const;
+
+ private:
+  CompressedInputStream();
+
+  class ARROW_NO_EXPORT CompressedInputStreamImpl;
+  std::unique_ptr<CompressedInputStreamImpl> impl_;
+};
+
+}  // namespace io
+}  // namespace arrow
+
+#endif  // ARROW_IO_COMPRESSED_H
@@ -51,6 +51,8 @@
 
 #ifndef _MSC_VER  // POSIX-like platforms
 
+#include <limits.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 // Not available on some platforms
@@ -73,6 +75,7 @@
 // C++ standard library
 
 #include <algorithm>
+#include <cstdlib>
 #include <cstring>
 #include <iostream>
 #include <limits>
@@ -103,6 +106,11 @@
 #define O_BINARY 0
 #endif
 
+// Largest transfer passed to a single read or write call. Windows takes the
+// length as an unsigned int and macOS fails requests above INT32_MAX, so
+// larger transfers are split into chunks
+#define ARROW_MAX_IO_CHUNKSIZE INT32_MAX
+
 // ----------------------------------------------------------------------
 // Other Arrow includes
 
@@ -112,6 +120,7 @@
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow {
 namespace io {
@@ -176,10 +185,13 @@ static inline Status ConvertToUtf16(const std::string& input, std::wstring* resu
 }
 #endif
 
-static inline Status FileOpenReadable(const std::string& filename, int* fd) {
+static inline Status FileOpenReadable(
+    const std::string& filename, bool direct_io, int* fd) {
   int ret;
   errno_t errno_actual = 0;
 #if defined(_MSC_VER)
+  if (direct_io) { return Status::NotImplemented("Direct I/O is not supported"); }
+
   std::wstring wide_filename;
   RETURN_NOT_OK(ConvertToUtf16(filename, &wide_filename));
 
@@ -187,8 +199,26 @@ static inline Status FileOpenReadable(const std::string& filename, int* fd) {
       _wsopen_s(fd, wide_filename.c_str(), _O_RDONLY | _O_BINARY, _SH_DENYNO, _S_IREAD);
   ret = *fd;
 #else
-  ret = *fd = open(filename.c_str(), O_RDONLY | O_BINARY);
+  int oflag = O_RDONLY | O_BINARY;
+  if (direct_io) {
+#if defined(O_DIRECT)
+    oflag |= O_DIRECT;
+#elif !defined(__APPLE__)
+    return Status::NotImplemented("Direct I/O is not supported");
+#endif
+  }
+
+  ret = *fd = open(filename.c_str(), oflag);
   errno_actual = errno;
+
+#if defined(__APPLE__)
+  // No O_DIRECT; reads still bypass the page cache with F_NOCACHE, and
+  // without alignment requirements
+  if (ret != -1 && direct_io && fcntl(*fd, F_NOCACHE, 1) == -1) {
+    close(*fd);
+    return Status::IOError("Unable to disable caching for file");
+  }
+#endif
 #endif
 
   return CheckOpenResult(ret, errno_actual, filename.c_str(), filename.size());
@@ -255,39 +285,203 @@ static inline Status FileSeek(int fd, int64_t pos) {
   return Status::OK();
 }
 
+// Read until nbytes have been read or end of file is reached
 static inline Status FileRead(
     int fd, uint8_t* buffer, int64_t nbytes, int64_t* bytes_read) {
+  *bytes_read = 0;
+  while (*bytes_read < nbytes) {
+    int64_t chunksize = std::min(
+        static_cast<int64_t>(ARROW_MAX_IO_CHUNKSIZE), nbytes - *bytes_read);
 #if defined(_MSC_VER)
-  if (nbytes > INT32_MAX) { return Status::IOError("Unable to read > 2GB blocks yet"); }
-  *bytes_read = static_cast<int64_t>(_read(fd, buffer, static_cast<uint32_t>(nbytes)));
+    int64_t ret = static_cast<int64_t>(
+        _read(fd, buffer + *bytes_read, static_cast<uint32_t>(chunksize)));
 #else
-  *bytes_read = static_cast<int64_t>(read(fd, buffer, static_cast<size_t>(nbytes)));
+    int64_t ret = static_cast<int64_t>(
+        read(fd, buffer + *bytes_read, static_cast<size_t>(chunksize)));
+    if (ret == -1 && errno == EINTR) { continue; }
 #endif
 
-  if (*bytes_read == -1) {
-    // TODO(wesm): errno to string
-    return Status::IOError("Error reading bytes from file");
+    if (ret == -1) {
+      // TODO(wesm): errno to string
+      return Status::IOError("Error reading bytes from file");
+    }
+    if (ret == 0) { break; }
+    *bytes_read += ret;
   }
 
   return Status::OK();
 }
 
+#ifndef _MSC_VER
+// Read at an absolute offset without moving the file position, retrying on
+// short reads so that only end of file ends the loop early
+static inline Status FileReadAt(
+    int fd, uint8_t* buffer, int64_t position, int64_t nbytes, int64_t* bytes_read) {
+  *bytes_read = 0;
+  while (*bytes_read < nbytes) {
+    int64_t chunksize = std::min(
+        static_cast<int64_t>(ARROW_MAX_IO_CHUNKSIZE), nbytes - *bytes_read);
+    ssize_t ret = pread(fd, buffer + *bytes_read, static_cast<size_t>(chunksize),
+        static_cast<off_t>(position));
+    if (ret == -1) {
+      if (errno == EINTR) { continue; }
+      return Status::IOError("Error reading bytes from file");
+    }
+    if (ret == 0) { break; }
+    *bytes_read += ret;
+    position += ret;
+  }
+  return Status::OK();
+}
+
+#if defined(O_DIRECT)
+// O_DIRECT requires the file offset, the length and the memory address of
+// each transfer to be multiples of the logical block size of the device
+constexpr int64_t kDirectIOAlignment = 4096;
+
+// Size of the aligned bounce buffer used for each direct transfer
+constexpr int64_t kDirectIOBufferSize = 1 << 22;
+
+struct AlignedFree {
+  void operator()(uint8_t* ptr) const { std::free(ptr); }
+};
+
+// Read through an aligned bounce buffer from a file opened with O_DIRECT,
+// copying the requested range into out
+static Status FileReadAtDirect(
+    int fd, uint8_t* out, int64_t position, int64_t nbytes, int64_t* bytes_read) {
+  *bytes_read = 0;
+  if (nbytes == 0) { return Status::OK(); }
+
+  const int64_t end = position + nbytes;
+  const int64_t aligned_start = position - position % kDirectIOAlignment;
+  const int64_t aligned_end =
+      (end + kDirectIOAlignment - 1) / kDirectIOAlignment * kDirectIOAlignment;
+  const int64_t bounce_size = std::min(kDirectIOBufferSize, aligned_end - aligned_start);
+
+  void* bounce_ptr = nullptr;
+  if (posix_memalign(&bounce_ptr, static_cast<size_t>(kDirectIOAlignment),
+          static_cast<size_t>(bounce_size))) {
+    return Status::OutOfMemory("Unable to allocate direct I/O buffer");
+  }
+  std::unique_ptr<uint8_t, AlignedFree> bounce(reinterpret_cast<uint8_t*>(bounce_ptr));
+
+  int64_t offset = aligned_start;
+  while (offset < aligned_end) {
+    const int64_t chunksize = std::min(bounce_size, aligned_end - offset);
+    ssize_t ret = pread(fd, bounce.get(), static_cast<size_t>(chunksize),
+        static_cast<off_t>(offset));
+    if (ret == -1) {
+      if (errno == EINTR) { continue; }
+      return Status::IOError("Error reading bytes from file");
+    }
+    if (ret == 0) { break; }
+
+    const int64_t lo = std::max(offset, position);
+    const int64_t hi = std::min(offset + ret, end);
+    if (hi > lo) {
+      std::memcpy(out + (lo - position), bounce.get() + (lo - offset),
+          static_cast<size_t>(hi - lo));
+      *bytes_read += hi - lo;
+    }
+
+    // A read that stops short of a block boundary has reached end of file
+    if (ret % kDirectIOAlignment != 0) { break; }
+    offset += ret;
+  }
+  return Status::OK();
+}
+#endif
+#endif
+
 static inline Status FileWrite(int fd, const uint8_t* buffer, int64_t nbytes) {
-  int ret;
+  int64_t bytes_written = 0;
+  while (bytes_written < nbytes) {
+    int64_t chunksize = std::min(
+        static_cast<int64_t>(ARROW_MAX_IO_CHUNKSIZE), nbytes - bytes_written);
 #if defined(_MSC_VER)
-  if (nbytes > INT32_MAX) {
-    return Status::IOError("Unable to write > 2GB blocks to file yet");
+    int64_t ret = static_cast<int64_t>(
+        _write(fd, buffer + bytes_written, static_cast<uint32_t>(chunksize)));
+#else
+    int64_t ret = static_cast<int64_t>(
+        write(fd, buffer + bytes_written, static_cast<size_t>(chunksize)));
+    if (ret == -1 && errno == EINTR) { continue; }
+#endif
+
+    if (ret == -1) {
+      // TODO(wesm): errno to string
+      return Status::IOError("Error writing bytes to file");
+    }
+    bytes_written += ret;
   }
-  ret = static_cast<int>(_write(fd, buffer, static_cast<uint32_t>(nbytes)));
+  return Status::OK();
+}
+
+#if !defined(_MSC_VER)
+#ifdef IOV_MAX
+static constexpr size_t kMaxIovecs = IOV_MAX;
 #else
-  ret = static_cast<int>(write(fd, buffer, static_cast<size_t>(nbytes)));
+static constexpr size_t kMaxIovecs = 1024;
+#endif
 #endif
 
-  if (ret == -1) {
-    // TODO(wesm): errno to string
-    return Status::IOError("Error writing bytes to file");
+// Write the buffers in order with as few system calls as possible
+static inline Status FileWritev(
+    int fd, const std::vector<std::shared_ptr<Buffer>>& buffers) {
+#if defined(_MSC_VER)
+  for (const auto& buffer : buffers) {
+    RETURN_NOT_OK(FileWrite(fd, buffer->data(), buffer->size()));
+  }
+  return Status::OK();
+#else
+  // The first buffer not completely written, and how much of it was
+  size_t index = 0;
+  int64_t offset = 0;
+
+  std::vector<struct iovec> iov;
+  while (true) {
+    while (index < buffers.size() && offset == buffers[index]->size()) {
+      ++index;
+      offset = 0;
+    }
+    if (index == buffers.size()) { break; }
+
+    iov.clear();
+    int64_t total = 0;
+    for (size_t i = index; i < buffers.size() && iov.size() < kMaxIovecs &&
+                           total < ARROW_MAX_IO_CHUNKSIZE;
+         ++i) {
+      const int64_t start = i == index ? offset : 0;
+      const int64_t length = std::min(
+          buffers[i]->size() - start, ARROW_MAX_IO_CHUNKSIZE - total);
+      if (length == 0) { continue; }
+      struct iovec entry;
+      entry.iov_base = const_cast<uint8_t*>(buffers[i]->data() + start);
+      entry.iov_len = static_cast<size_t>(length);
+      iov.push_back(entry);
+      total += length;
+    }
+
+    int64_t ret =
+        static_cast<int64_t>(writev(fd, iov.data(), static_cast<int>(iov.size())));
+    if (ret == -1 && errno == EINTR) { continue; }
+    if (ret == -1) { return Status::IOError("Error writing bytes to file"); }
+
+    // Short writes resume from the first byte not written
+    while (ret > 0) {
+      const int64_t remaining = buffers[index]->size() - offset;
+      if (ret >= remaining) {
+        ret -= remaining;
+        ++index;
+        offset = 0;
+      } else {
+        offset += ret;
+        ret = 0;
+      }
+    }
   }
   return Status::OK();
+#endif
 }
 
 static inline Status FileGetSize(int fd, int64_t* size) {
@@ -314,6 +508,21 @@ static inline Status FileGetSize(int fd, int64_t* size) {
   return Status::OK();
 }
 
+static inline Status FileTruncate(int fd, int64_t size) {
+  int ret;
+#if defined(_MSC_VER)
+  ret = static_cast<int>(_chsize_s(fd, static_cast<size_t>(size)));
+#else
+  ret = static_cast<int>(ftruncate(fd, static_cast<off_t>(size)));
+#endif
+  if (ret == -1) {
+    std::stringstream ss;
+    ss << "Error resizing file: " << std::strerror(errno);
+    return Status::IOError(ss.str());
+  }
+  return Status::OK();
+}
+
 static inline Status FileClose(int fd) {
   int ret;
 
@@ -347,8 +556,8 @@ class OSFile {
     return Status::OK();
   }
 
-  Status OpenReadable(const std::string& path) {
-    RETURN_NOT_OK(FileOpenReadable(path, &fd_));
+  Status OpenReadable(const std::string& path, bool direct_io = false) {
+    RETURN_NOT_OK(FileOpenReadable(path, direct_io, &fd_));
     RETURN_NOT_OK(FileGetSize(fd_, &size_));
 
     path_ = path;
@@ -370,6 +579,22 @@ class OSFile {
     return FileRead(fd_, out, nbytes, bytes_read);
   }
 
+  // Does not change the file position. Lock-free on POSIX platforms
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read, uint8_t* out) {
+    if (position < 0) { return Status::Invalid("Invalid position"); }
+#if defined(_MSC_VER)
+    // No pread; emulate it by seeking and restoring the position under the lock
+    std::lock_guard<std::mutex> guard(lock_);
+    int64_t current_position;
+    RETURN_NOT_OK(FileTell(fd_, &current_position));
+    RETURN_NOT_OK(FileSeek(fd_, position));
+    RETURN_NOT_OK(FileRead(fd_, out, nbytes, bytes_read));
+    return FileSeek(fd_, current_position);
+#else
+    return FileReadAt(fd_, out, position, nbytes, bytes_read);
+#endif
+  }
+
   Status Seek(int64_t pos) {
     if (pos < 0) { return Status::Invalid("Invalid position"); }
     return FileSeek(fd_, pos);
@@ -383,6 +608,11 @@ class OSFile {
     return FileWrite(fd_, data, length);
   }
 
+  Status Writev(const std::vector<std::shared_ptr<Buffer>>& buffers) {
+    std::lock_guard<std::mutex> guard(lock_);
+    return FileWritev(fd_, buffers);
+  }
+
   int fd() const { return fd_; }
 
   bool is_open() const { return is_open_; }
@@ -409,11 +639,41 @@ class OSFile {
 // ----------------------------------------------------------------------
 // ReadableFile implementation
 
+static constexpr int kDefaultReadThreads = 4;
+
 class ReadableFile::ReadableFileImpl : public OSFile {
  public:
-  explicit ReadableFileImpl(MemoryPool* pool) : OSFile(), pool_(pool) {}
+  explicit ReadableFileImpl(MemoryPool* pool)
+      : OSFile(), pool_(pool), aligned_io_(false), read_threads_(kDefaultReadThreads) {}
+
+  Status Open(const std::string& path, bool direct_io) {
+    RETURN_NOT_OK(OpenReadable(path, direct_io));
+#if defined(O_DIRECT) && !defined(_MSC_VER)
+    aligned_io_ = direct_io;
+#endif
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, uint8_t* out) {
+    if (!aligned_io_) { return OSFile::Read(nbytes, bytes_read, out); }
+
+    // Direct reads are positional, so advance the file position by hand
+    std::lock_guard<std::mutex> guard(lock_);
+    int64_t position = 0;
+    RETURN_NOT_OK(FileTell(fd_, &position));
+    RETURN_NOT_OK(ReadAt(position, nbytes, bytes_read, out));
+    return FileSeek(fd_, position + *bytes_read);
+  }
 
-  Status Open(const std::string& path) { return OpenReadable(path); }
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read, uint8_t* out) {
+#if defined(O_DIRECT) && !defined(_MSC_VER)
+    if (aligned_io_) {
+      if (position < 0) { return Status::Invalid("Invalid position"); }
+      return FileReadAtDirect(fd_, out, position, nbytes, bytes_read);
+    }
+#endif
+    return OSFile::ReadAt(position, nbytes, bytes_read, out);
+  }
 
   Status ReadBuffer(int64_t nbytes, std::shared_ptr<Buffer>* out) {
     std::shared_ptr<ResizableBuffer> buffer;
@@ -426,8 +686,35 @@ class ReadableFile::ReadableFileImpl : public OSFile {
     return Status::OK();
   }
 
+  Status ReadBufferAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    std::shared_ptr<ResizableBuffer> buffer;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buffer));
+
+    int64_t bytes_read = 0;
+    RETURN_NOT_OK(ReadAt(position, nbytes, &bytes_read, buffer->mutable_data()));
+    if (bytes_read < nbytes) { RETURN_NOT_OK(buffer->Resize(bytes_read)); }
+    *out = buffer;
+    return Status::OK();
+  }
+
+  Status ReadBuffersAt(
+      const std::vector<ReadRange>& ranges, std::vector<std::shared_ptr<Buffer>>* out) {
+    out->resize(ranges.size());
+    return ParallelFor(static_cast<int64_t>(ranges.size()), read_threads_,
+        [&](int, int64_t i) {
+          return ReadBufferAt(ranges[i].offset, ranges[i].length, &(*out)[i]);
+        });
+  }
+
+  void set_read_threads(int num_threads) { read_threads_ = std::max(num_threads, 1); }
+
  private:
   MemoryPool* pool_;
+
+  // Whether the file was opened with O_DIRECT, requiring aligned transfers
+  bool aligned_io_;
+
+  int read_threads_;
 };
 
 ReadableFile::ReadableFile(MemoryPool* pool) {
@@ -440,13 +727,19 @@ ReadableFile::~ReadableFile() {
 
 Status ReadableFile::Open(const std::string& path, std::shared_ptr<ReadableFile>* file) {
   *file = std::shared_ptr<ReadableFile>(new ReadableFile(default_memory_pool()));
-  return (*file)->impl_->Open(path);
+  return (*file)->impl_->Open(path, false);
 }
 
 Status ReadableFile::Open(const std::string& path, MemoryPool* memory_pool,
     std::shared_ptr<ReadableFile>* file) {
   *file = std::shared_ptr<ReadableFile>(new ReadableFile(memory_pool));
-  return (*file)->impl_->Open(path);
+  return (*file)->impl_->Open(path, false);
+}
+
+Status ReadableFile::Open(const std::string& path, MemoryPool* memory_pool,
+    bool direct_io, std::shared_ptr<ReadableFile>* file) {
+  *file = std::shared_ptr<ReadableFile>(new ReadableFile(memory_pool));
+  return (*file)->impl_->Open(path, direct_io);
 }
 
 Status ReadableFile::Close() {
@@ -465,6 +758,16 @@ Status ReadableFile::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
   return impl_->ReadBuffer(nbytes, out);
 }
 
+Status ReadableFile::ReadAt(
+    int64_t position, int64_t nbytes, int64_t* bytes_read, uint8_t* out) {
+  return impl_->ReadAt(position, nbytes, bytes_read, out);
+}
+
+Status ReadableFile::ReadAt(
+    int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  return impl_->ReadBufferAt(position, nbytes, out);
+}
+
 Status ReadableFile::GetSize(int64_t* size) {
   *size = impl_->size();
   return Status::OK();
@@ -482,6 +785,15 @@ int ReadableFile::file_descriptor() const {
   return impl_->fd();
 }
 
+void ReadableFile::set_read_threads(int num_threads) {
+  impl_->set_read_threads(num_threads);
+}
+
+Status ReadableFile::ReadCoalescedRanges(
+    const std::vector<ReadRange>& ranges, std::vector<std::shared_ptr<Buffer>>* out) {
+  return impl_->ReadBuffersAt(ranges, out);
+}
+
 // ----------------------------------------------------------------------
 // FileOutputStream
 
@@ -525,6 +837,10 @@ Status FileOutputStream::Write(const uint8_t* data, int64_t length) {
   return impl_->Write(data, length);
 }
 
+Status FileOutputStream::Writev(const std::vector<std::shared_ptr<Buffer>>& buffers) {
+  return impl_->Writev(buffers);
+}
+
 int FileOutputStream::file_descriptor() const {
   return impl_->fd();
 }
@@ -532,51 +848,77 @@ int FileOutputStream::file_descriptor() const {
 // ----------------------------------------------------------------------
 // Implement MemoryMappedFile
 
+// Granularity of mapping offsets and madvise addresses
+static int64_t GetPageSize() {
+#if defined(_WIN32)
+  SYSTEM_INFO si;
+  GetSystemInfo(&si);
+  return static_cast<int64_t>(si.dwAllocationGranularity);
+#else
+  return static_cast<int64_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+static Status MemoryMapError(const char* what) {
+  std::stringstream ss;
+  ss << what << ", errno: " << errno;
+  return Status::IOError(ss.str());
+}
+
+// The mapping of [region_offset_, region_offset_ + capacity_) of the file. As
+// mmap offsets must be page-aligned, the mapping itself starts up to a page
+// earlier, at map_base_. The Buffer covers the size_ bytes written or readable
+// so far, which may be less than capacity_ while a writable map grows
 class MemoryMappedFile::MemoryMap : public MutableBuffer {
  public:
-  MemoryMap() : MutableBuffer(nullptr, 0) {}
+  MemoryMap()
+      : MutableBuffer(nullptr, 0),
+        position_(0),
+        region_offset_(0),
+        capacity_(0),
+        map_base_(nullptr),
+        map_length_(0),
+        whole_file_(true) {}
 
   ~MemoryMap() {
     if (file_->is_open()) {
-      munmap(mutable_data_, static_cast<size_t>(size_));
+      DCHECK(Trim().ok());
+      if (map_base_ != nullptr) { munmap(map_base_, static_cast<size_t>(map_length_)); }
       DCHECK(file_->Close().ok());
     }
   }
 
-  Status Open(const std::string& path, FileMode::type mode) {
-    int prot_flags;
-    int map_mode;
-
+  Status Open(
+      const std::string& path, FileMode::type mode, int64_t offset, int64_t length) {
     file_.reset(new OSFile());
 
     if (mode != FileMode::READ) {
       // Memory mapping has permission failures if PROT_READ not set
-      prot_flags = PROT_READ | PROT_WRITE;
-      map_mode = MAP_SHARED;
+      prot_flags_ = PROT_READ | PROT_WRITE;
+      map_mode_ = MAP_SHARED;
       constexpr bool append = true;
       constexpr bool write_only = false;
       RETURN_NOT_OK(file_->OpenWriteable(path, append, write_only));
 
       is_mutable_ = true;
     } else {
-      prot_flags = PROT_READ;
-      map_mode = MAP_PRIVATE;  // Changes are not to be committed back to the file
+      prot_flags_ = PROT_READ;
+      map_mode_ = MAP_PRIVATE;  // Changes are not to be committed back to the file
       RETURN_NOT_OK(file_->OpenReadable(path));
 
       is_mutable_ = false;
     }
 
-    void* result = mmap(nullptr, static_cast<size_t>(file_->size()), prot_flags, map_mode,
-        file_->fd(), 0);
-    if (result == MAP_FAILED) {
-      std::stringstream ss;
-      ss << "Memory mapping file failed, errno: " << errno;
-      return Status::IOError(ss.str());
+    const int64_t file_size = file_->size();
+    if (length < 0) { length = file_size - offset; }
+    if (offset < 0 || offset > file_size || length > file_size - offset) {
+      return Status::Invalid("Memory map region is outside of the file");
     }
+    region_offset_ = offset;
+    whole_file_ = offset == 0 && length == file_size;
 
-    data_ = mutable_data_ = reinterpret_cast<uint8_t*>(result);
-    size_ = file_->size();
-
+    RETURN_NOT_OK(Map(length));
+    size_ = length;
     position_ = 0;
 
     return Status::OK();
@@ -598,13 +940,199 @@ class MemoryMappedFile::MemoryMap : public MutableBuffer {
 
   bool writable() { return file_->mode() != FileMode::READ; }
 
+  // Whether Resize and writes can remap the memory
+  bool growable() { return whole_file_ && writable(); }
+
   bool opened() { return file_->is_open(); }
 
   int fd() const { return file_->fd(); }
 
+  // Make room for writing up to end, growing the file geometrically so a
+  // sequence of appends remaps the file only a logarithmic number of times
+  Status Reserve(int64_t end, bool can_move) {
+    if (end > capacity_) {
+      if (!whole_file_) {
+        return Status::Invalid("Cannot write past end of memory map");
+      }
+      const int64_t page_size = GetPageSize();
+      int64_t new_capacity = std::max(end, capacity_ * 2);
+      new_capacity = (new_capacity + page_size - 1) / page_size * page_size;
+      RETURN_NOT_OK(Grow(new_capacity, can_move));
+    }
+    size_ = std::max(size_, end);
+    return Status::OK();
+  }
+
+  Status Resize(int64_t new_size, bool can_move) {
+    if (!writable()) { return Status::IOError("Cannot resize a read-only memory map"); }
+    if (!whole_file_) {
+      return Status::Invalid("Cannot resize a memory map of part of a file");
+    }
+    if (new_size < 0) { return Status::Invalid("Size must be non-negative"); }
+    if (new_size < size_ && !can_move) {
+      return Status::IOError(
+          "Cannot shrink a memory map while Buffers reference it");
+    }
+
+    // Extend the file before mapping the new pages, and unmap pages before
+    // removing them from the file
+    if (new_size > capacity_) {
+      RETURN_NOT_OK(Grow(new_size, can_move));
+    } else {
+      RETURN_NOT_OK(Remap(new_size, can_move));
+      RETURN_NOT_OK(FileTruncate(file_->fd(), new_size));
+    }
+    size_ = new_size;
+    return Status::OK();
+  }
+
+  // Give back the file space reserved by growing writes beyond the data
+  // written. The mapping is left in place for any outstanding Buffers
+  Status Trim() {
+    if (whole_file_ && writable() && capacity_ > size_) {
+      RETURN_NOT_OK(FileTruncate(file_->fd(), size_));
+      capacity_ = size_;
+    }
+    return Status::OK();
+  }
+
+  Status Advise(MemoryAdvice::type advice, int64_t position, int64_t nbytes) {
+    if (position < 0 || nbytes < 0) {
+      return Status::Invalid("Advice range is out of bounds");
+    }
+    nbytes = std::min(nbytes, capacity_ - position);
+    if (nbytes <= 0) { return Status::OK(); }
+#if defined(_WIN32)
+    // madvise is not available; the hints are advisory only
+    return Status::OK();
+#else
+    int native_advice = MADV_NORMAL;
+    switch (advice) {
+      case MemoryAdvice::NORMAL:
+        native_advice = MADV_NORMAL;
+        break;
+      case MemoryAdvice::SEQUENTIAL:
+        native_advice = MADV_SEQUENTIAL;
+        break;
+      case MemoryAdvice::RANDOM:
+        native_advice = MADV_RANDOM;
+        break;
+      case MemoryAdvice::WILLNEED:
+        native_advice = MADV_WILLNEED;
+        break;
+      case MemoryAdvice::DONTNEED:
+        native_advice = MADV_DONTNEED;
+        break;
+    }
+
+    // madvise requires a page-aligned address
+    const int64_t page_size = GetPageSize();
+    uint8_t* start = mutable_data_ + position;
+    const int64_t misalignment =
+        static_cast<int64_t>(reinterpret_cast<uintptr_t>(start) % page_size);
+    if (madvise(start - misalignment, static_cast<size_t>(nbytes + misalignment),
+            native_advice) != 0) {
+      return MemoryMapError("madvise failed");
+    }
+    return Status::OK();
+#endif
+  }
+
  private:
+  // Extend a whole-file map to capacity. If the mapping cannot follow, the
+  // file is truncated back so that it does not keep the new zeroed pages
+  Status Grow(int64_t capacity, bool can_move) {
+    RETURN_NOT_OK(FileTruncate(file_->fd(), capacity));
+    Status st = Remap(capacity, can_move);
+    if (!st.ok()) { ARROW_IGNORE_EXPR(FileTruncate(file_->fd(), capacity_)); }
+    return st;
+  }
+
+  // Map capacity bytes of the file from region_offset_
+  Status Map(int64_t capacity) {
+    const int64_t page_size = GetPageSize();
+    const int64_t map_offset = region_offset_ / page_size * page_size;
+    const int64_t map_length = capacity + region_offset_ - map_offset;
+
+    // Empty files cannot be mapped; the mapping is created when they grow
+    if (capacity > 0) {
+      void* result = mmap(nullptr, static_cast<size_t>(map_length), prot_flags_,
+          map_mode_, file_->fd(), static_cast<off_t>(map_offset));
+      if (result == MAP_FAILED) { return MemoryMapError("Memory mapping file failed"); }
+      map_base_ = reinterpret_cast<uint8_t*>(result);
+      map_length_ = map_length;
+    }
+    SetMapping(capacity);
+    return Status::OK();
+  }
+
+  // Change the mapped length of a whole-file map. Mappings are extended in
+  // place when possible, as moving them invalidates the addresses held by
+  // outstanding Buffers
+  Status Remap(int64_t capacity, bool can_move) {
+    if (map_base_ == nullptr) { return Map(capacity); }
+    if (capacity == 0) {
+      if (munmap(map_base_, static_cast<size_t>(map_length_)) != 0) {
+        return MemoryMapError("munmap failed");
+      }
+      map_base_ = nullptr;
+      map_length_ = 0;
+      SetMapping(0);
+      return Status::OK();
+    }
+
+#if defined(__linux__)
+    void* result = mremap(map_base_, static_cast<size_t>(map_length_),
+        static_cast<size_t>(capacity), 0);
+    if (result == MAP_FAILED && can_move) {
+      result = mremap(map_base_, static_cast<size_t>(map_length_),
+          static_cast<size_t>(capacity), MREMAP_MAYMOVE);
+    }
+    if (result == MAP_FAILED) {
+      return can_move ? MemoryMapError("mremap failed")
+                      : Status::IOError(
+                            "Cannot move a memory map while Buffers reference it");
+    }
+    map_base_ = reinterpret_cast<uint8_t*>(result);
+    map_length_ = capacity;
+    SetMapping(capacity);
+    return Status::OK();
+#else
+    // No mremap: map the file again
+    if (!can_move) {
+      return Status::IOError("Cannot move a memory map while Buffers reference it");
+    }
+    if (munmap(map_base_, static_cast<size_t>(map_length_)) != 0) {
+      return MemoryMapError("munmap failed");
+    }
+    map_base_ = nullptr;
+    map_length_ = 0;
+    return Map(capacity);
+#endif
+  }
+
+  void SetMapping(int64_t capacity) {
+    if (map_base_ == nullptr) {
+      data_ = mutable_data_ = nullptr;
+    } else {
+      data_ = mutable_data_ = map_base_ + (map_length_ - capacity);
+    }
+    capacity_ = capacity;
+  }
+
   std::unique_ptr<OSFile> file_;
   int64_t position_;
+  int prot_flags_;
+  int map_mode_;
+
+  // The mapped part of the file
+  int64_t region_offset_;
+  int64_t capacity_;
+  uint8_t* map_base_;
+  int64_t map_length_;
+
+  // Only maps of a whole writable file can grow
+  bool whole_file_;
 };
 
 MemoryMappedFile::MemoryMappedFile() {}
@@ -614,26 +1142,43 @@ Status MemoryMappedFile::Create(
     const std::string& path, int64_t size, std::shared_ptr<MemoryMappedFile>* out) {
   std::shared_ptr<FileOutputStream> file;
   RETURN_NOT_OK(FileOutputStream::Open(path, &file));
-#ifdef _MSC_VER
-  _chsize_s(file->file_descriptor(), static_cast<size_t>(size));
-#else
-  ftruncate(file->file_descriptor(), static_cast<size_t>(size));
-#endif
+  RETURN_NOT_OK(FileTruncate(file->file_descriptor(), size));
   RETURN_NOT_OK(file->Close());
   return MemoryMappedFile::Open(path, FileMode::READWRITE, out);
 }
 
 Status MemoryMappedFile::Open(const std::string& path, FileMode::type mode,
     std::shared_ptr<MemoryMappedFile>* out) {
+  return Open(path, mode, 0, -1, out);
+}
+
+Status MemoryMappedFile::Open(const std::string& path, FileMode::type mode,
+    int64_t offset, int64_t length, std::shared_ptr<MemoryMappedFile>* out) {
   std::shared_ptr<MemoryMappedFile> result(new MemoryMappedFile());
 
   result->memory_map_.reset(new MemoryMap());
-  RETURN_NOT_OK(result->memory_map_->Open(path, mode));
+  RETURN_NOT_OK(result->memory_map_->Open(path, mode, offset, length));
 
   *out = result;
   return Status::OK();
 }
 
+Status MemoryMappedFile::Advise(MemoryAdvice::type advice) {
+  auto guard = ReadLock();
+  return memory_map_->Advise(advice, 0, memory_map_->size());
+}
+
+Status MemoryMappedFile::Advise(
+    MemoryAdvice::type advice, int64_t position, int64_t nbytes) {
+  auto guard = ReadLock();
+  return memory_map_->Advise(advice, position, nbytes);
+}
+
+Status MemoryMappedFile::Resize(int64_t new_size) {
+  std::lock_guard<std::mutex> guard(lock_);
+  return memory_map_->Resize(new_size, memory_map_.use_count() == 1);
+}
+
 Status MemoryMappedFile::GetSize(int64_t* size) {
   *size = memory_map_->size();
   return Status::OK();
@@ -650,10 +1195,18 @@ Status MemoryMappedFile::Seek(int64_t position) {
 
 Status MemoryMappedFile::Close() {
   // munmap handled in pimpl dtor
-  return Status::OK();
+  std::lock_guard<std::mutex> guard(lock_);
+  return memory_map_->Trim();
+}
+
+std::unique_lock<std::mutex> MemoryMappedFile::ReadLock() {
+  std::unique_lock<std::mutex> guard(lock_, std::defer_lock);
+  if (memory_map_->growable()) { guard.lock(); }
+  return guard;
 }
 
 Status MemoryMappedFile::Read(int64_t nbytes, int64_t* bytes_read, uint8_t* out) {
+  auto guard = ReadLock();
   nbytes = std::max<int64_t>(
       0, std::min(nbytes, memory_map_->size() - memory_map_->position()));
   if (nbytes > 0) { std::memcpy(out, memory_map_->head(), static_cast<size_t>(nbytes)); }
@@ -663,6 +1216,7 @@ Status MemoryMappedFile::Read(int64_t nbytes, int64_t* bytes_read, uint8_t* out)
 }
 
 Status MemoryMappedFile::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  auto guard = ReadLock();
   nbytes = std::max<int64_t>(
       0, std::min(nbytes, memory_map_->size() - memory_map_->position()));
 
@@ -675,6 +1229,32 @@ Status MemoryMappedFile::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
   return Status::OK();
 }
 
+Status MemoryMappedFile::ReadAt(
+    int64_t position, int64_t nbytes, int64_t* bytes_read, uint8_t* out) {
+  auto guard = ReadLock();
+  if (position < 0) { return Status::Invalid("position is out of bounds"); }
+  nbytes = std::max<int64_t>(0, std::min(nbytes, memory_map_->size() - position));
+  if (nbytes > 0) {
+    std::memcpy(out, memory_map_->data() + position, static_cast<size_t>(nbytes));
+  }
+  *bytes_read = nbytes;
+  return Status::OK();
+}
+
+Status MemoryMappedFile::ReadAt(
+    int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  auto guard = ReadLock();
+  if (position < 0) { return Status::Invalid("position is out of bounds"); }
+  nbytes = std::max<int64_t>(0, std::min(nbytes, memory_map_->size() - position));
+
+  if (nbytes > 0) {
+    *out = SliceBuffer(memory_map_, position, nbytes);
+  } else {
+    *out = std::make_shared<Buffer>(nullptr, 0);
+  }
+  return Status::OK();
+}
+
 bool MemoryMappedFile::supports_zero_copy() const {
   return true;
 }
@@ -696,13 +1276,14 @@ Status MemoryMappedFile::Write(const uint8_t* data, int64_t nbytes) {
   if (!memory_map_->opened() || !memory_map_->writable()) {
     return Status::IOError("Unable to write");
   }
-  if (nbytes + memory_map_->position() > memory_map_->size()) {
-    return Status::Invalid("Cannot write past end of memory map");
-  }
   return WriteInternal(data, nbytes);
 }
 
 Status MemoryMappedFile::WriteInternal(const uint8_t* data, int64_t nbytes) {
+  if (nbytes < 0) { return Status::Invalid("Length must be non-negative"); }
+  if (nbytes == 0) { return Status::OK(); }
+  RETURN_NOT_OK(memory_map_->Reserve(
+      memory_map_->position() + nbytes, memory_map_.use_count() == 1));
   memcpy(memory_map_->head(), data, static_cast<size_t>(nbytes));
   memory_map_->advance(nbytes);
   return Status::OK();
@@ -23,6 +23,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/io/interfaces.h"
 #include "arrow/util/macros.h"
@@ -54,6 +55,10 @@ class ARROW_EXPORT FileOutputStream : public OutputStream {
   // Write bytes to the stream. Thread-safe
   Status Write(const uint8_t* data, int64_t nbytes) override;
 
+  /// Write the buffers in order as one gathered write (writev), without
+  /// copying them together first. Thread-safe
+  Status Writev(const std::vector<std::shared_ptr<Buffer>>& buffers) override;
+
   int file_descriptor() const;
 
  private:
@@ -75,6 +80,13 @@ class ARROW_EXPORT ReadableFile : public RandomAccessFile {
   static Status Open(const std::string& path, MemoryPool* memory_pool,
       std::shared_ptr<ReadableFile>* file);
 
+  // Open file, optionally bypassing the operating system page cache
+  // (O_DIRECT on Linux, F_NOCACHE on macOS). Direct reads go through aligned
+  // bounce buffers, so any position and length may be read; intended for
+  // large sequential reads of data that will not be read again
+  static Status Open(const std::string& path, MemoryPool* memory_pool, bool direct_io,
+      std::shared_ptr<ReadableFile>* file);
+
   Status Close() override;
   Status Tell(int64_t* position) override;
 
@@ -82,6 +94,12 @@ class ARROW_EXPORT ReadableFile : public RandomAccessFile {
   Status Read(int64_t nbytes, int64_t* bytes_read, uint8_t* buffer) override;
   Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
 
+  // Read bytes at a position using pread, without moving the file position.
+  // Thread-safe and does not take a lock on POSIX platforms
+  Status ReadAt(
+      int64_t position, int64_t nbytes, int64_t* bytes_read, uint8_t* out) override;
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
   Status GetSize(int64_t* size) override;
   Status Seek(int64_t position) override;
 
@@ -89,6 +107,15 @@ class ARROW_EXPORT ReadableFile : public RandomAccessFile {
 
   int file_descriptor() const;
 
+  /// Set the number of threads issuing reads at once in ReadRanges. Defaults
+  /// to 4; 1 reads the ranges in turn on the calling thread
+  void set_read_threads(int num_threads);
+
+ protected:
+  // Reads the ranges with concurrent pread calls from several threads
+  Status ReadCoalescedRanges(const std::vector<ReadRange>& ranges,
+      std::vector<std::shared_ptr<Buffer>>* out) override;
+
  private:
   explicit ReadableFile(MemoryPool* pool);
 
@@ -96,12 +123,18 @@ class ARROW_EXPORT ReadableFile : public RandomAccessFile {
   std::unique_ptr<ReadableFileImpl> impl_;
 };
 
+/// Access pattern hints for a memory map, passed to madvise
+struct MemoryAdvice {
+  enum type { NORMAL, SEQUENTIAL, RANDOM, WILLNEED, DONTNEED };
+};
+
 // A file interface that uses memory-mapped files for memory interactions,
 // supporting zero copy reads. The same class is used for both reading and
 // writing.
 //
 // If opening a file in a writeable mode, it is not truncated first as with
-// FileOutputStream
+// FileOutputStream. Writes past the end of a writable map of a whole file
+// grow the file, so it need not be sized in advance
 class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
  public:
   ~MemoryMappedFile();
@@ -113,6 +146,27 @@ class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
   static Status Open(const std::string& path, FileMode::type mode,
       std::shared_ptr<MemoryMappedFile>* out);
 
+  /// Map only length bytes of the file starting at offset, or the rest of the
+  /// file if length is -1. Positions are relative to offset. Maps of part of a
+  /// file cannot grow
+  static Status Open(const std::string& path, FileMode::type mode, int64_t offset,
+      int64_t length, std::shared_ptr<MemoryMappedFile>* out);
+
+  /// Hint how the whole map will be accessed, e.g. SEQUENTIAL for more
+  /// aggressive kernel readahead. A no-op where madvise is not available
+  Status Advise(MemoryAdvice::type advice);
+
+  /// Hint how nbytes from position will be accessed, e.g. WILLNEED to start
+  /// reading them in before they are needed
+  Status Advise(MemoryAdvice::type advice, int64_t position, int64_t nbytes);
+
+  /// Change the size of the file and of a writable map of it. Growing
+  /// extends the mapping in place if possible; it can only be moved, and the
+  /// map only shrunk, when no Buffers read from it are alive. Thread-safe
+  Status Resize(int64_t new_size);
+
+  /// Truncate the file to the data written, if writes grew it. The memory is
+  /// unmapped when the last Buffer referencing it is destroyed
   Status Close() override;
 
   Status Tell(int64_t* position) override;
@@ -125,9 +179,20 @@ class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
   // Zero copy read. Not thread-safe
   Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
 
+  // Copy bytes at a position into out, without moving the file position.
+  // Thread-safe. Lock-free, except on writable maps of a whole file, whose
+  // mapping can move when they grow
+  Status ReadAt(
+      int64_t position, int64_t nbytes, int64_t* bytes_read, uint8_t* out) override;
+
+  // Zero copy read at a position, without moving the file position.
+  // Thread-safe, and lock-free in the same cases as the copying ReadAt
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
   bool supports_zero_copy() const override;
 
-  /// Write data at the current position in the file. Thread-safe
+  /// Write data at the current position in the file, growing it if needed.
+  /// Thread-safe
   Status Write(const uint8_t* data, int64_t nbytes) override;
 
   /// Write data at a particular position in the file. Thread-safe
@@ -143,6 +208,10 @@ class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
 
   Status WriteInternal(const uint8_t* data, int64_t nbytes);
 
+  // Hold the file lock while reading a map that Resize or a growing write
+  // may move or shrink; other maps are read without locking
+  std::unique_lock<std::mutex> ReadLock();
+
   class ARROW_NO_EXPORT MemoryMap;
   std::shared_ptr<MemoryMap> memory_map_;
 };
@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/io/hdfs-internal.h"
@@ -120,9 +121,14 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
       ret = driver_->Pread(fs_, file_, static_cast<tOffset>(position),
           reinterpret_cast<void*>(buffer), static_cast<tSize>(nbytes));
     } else {
+      // Restore the position, as ReadAt leaves it unchanged
       std::lock_guard<std::mutex> guard(lock_);
+      int64_t current_position = 0;
+      RETURN_NOT_OK(Tell(&current_position));
       RETURN_NOT_OK(Seek(position));
-      return Read(nbytes, bytes_read, buffer);
+      Status st = Read(nbytes, bytes_read, buffer);
+      RETURN_NOT_OK(Seek(current_position));
+      return st;
     }
     RETURN_NOT_OK(CheckReadResult(ret));
     *bytes_read = ret;
@@ -237,6 +243,9 @@ Status HdfsReadableFile::Tell(int64_t* position) {
 // File writing
 
 // Private implementation for writeable-only files
+// Buffers smaller than this are packed together for a gathered write
+static constexpr int64_t kHdfsCoalesceLimit = 1 << 16;
+
 class HdfsOutputStream::HdfsOutputStreamImpl : public HdfsAnyFileImpl {
  public:
   HdfsOutputStreamImpl() {}
@@ -259,6 +268,38 @@ class HdfsOutputStream::HdfsOutputStreamImpl : public HdfsAnyFileImpl {
 
   Status Write(const uint8_t* buffer, int64_t nbytes, int64_t* bytes_written) {
     std::lock_guard<std::mutex> guard(lock_);
+    return WriteUnlocked(buffer, nbytes, bytes_written);
+  }
+
+  Status Writev(const std::vector<std::shared_ptr<Buffer>>& buffers) {
+    std::lock_guard<std::mutex> guard(lock_);
+    int64_t bytes_written;
+
+    std::vector<uint8_t> staging;
+    auto WriteStaging = [&]() {
+      if (staging.empty()) { return Status::OK(); }
+      RETURN_NOT_OK(WriteUnlocked(
+          staging.data(), static_cast<int64_t>(staging.size()), &bytes_written));
+      staging.clear();
+      return Status::OK();
+    };
+
+    for (const auto& buffer : buffers) {
+      if (buffer->size() >= kHdfsCoalesceLimit) {
+        RETURN_NOT_OK(WriteStaging());
+        RETURN_NOT_OK(WriteUnlocked(buffer->data(), buffer->size(), &bytes_written));
+        continue;
+      }
+      if (static_cast<int64_t>(staging.size()) + buffer->size() > kHdfsCoalesceLimit) {
+        RETURN_NOT_OK(WriteStaging());
+      }
+      staging.insert(staging.end(), buffer->data(), buffer->data() + buffer->size());
+    }
+    return WriteStaging();
+  }
+
+ private:
+  Status WriteUnlocked(const uint8_t* buffer, int64_t nbytes, int64_t* bytes_written) {
     tSize ret = driver_->Write(
         fs_, file_, reinterpret_cast<const void*>(buffer), static_cast<tSize>(nbytes));
     CHECK_FAILURE(ret, "Write");
@@ -289,6 +330,10 @@ Status HdfsOutputStream::Write(const uint8_t* buffer, int64_t nbytes) {
   return Write(buffer, nbytes, &bytes_written_dummy);
 }
 
+Status HdfsOutputStream::Writev(const std::vector<std::shared_ptr<Buffer>>& buffers) {
+  return impl_->Writev(buffers);
+}
+
 Status HdfsOutputStream::Flush() {
   return impl_->Flush();
 }
@@ -208,6 +208,10 @@ class ARROW_EXPORT HdfsOutputStream : public OutputStream {
 
   Status Write(const uint8_t* buffer, int64_t nbytes, int64_t* bytes_written);
 
+  /// Write the buffers under one lock, packing runs of small buffers into
+  /// one libhdfs write, as each write crosses into the JVM
+  Status Writev(const std::vector<std::shared_ptr<Buffer>>& buffers) override;
+
   Status Flush() override;
 
   Status Tell(int64_t* position) override;
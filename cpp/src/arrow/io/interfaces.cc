@@ -17,34 +17,140 @@
 
 #include "arrow/io/interfaces.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/status.h"
+#include "arrow/util/logging.h"
 
 namespace arrow {
 namespace io {
 
 FileInterface::~FileInterface() {}
 
+// The most bytes InputStream::Advance reads at a time
+static constexpr int64_t kAdvanceChunkSize = 64 * 1024;
+
+Status InputStream::Advance(int64_t nbytes) {
+  std::vector<uint8_t> scratch(static_cast<size_t>(std::min(nbytes, kAdvanceChunkSize)));
+  while (nbytes > 0) {
+    int64_t bytes_read;
+    RETURN_NOT_OK(Read(std::min(nbytes, kAdvanceChunkSize), &bytes_read, scratch.data()));
+    if (bytes_read == 0) { return Status::IOError("Unexpected end of stream"); }
+    nbytes -= bytes_read;
+  }
+  return Status::OK();
+}
+
 RandomAccessFile::RandomAccessFile() {
   set_mode(FileMode::READ);
 }
 
+Status RandomAccessFile::Advance(int64_t nbytes) {
+  int64_t position;
+  RETURN_NOT_OK(Tell(&position));
+  return Seek(position + nbytes);
+}
+
 Status RandomAccessFile::ReadAt(
     int64_t position, int64_t nbytes, int64_t* bytes_read, uint8_t* out) {
   std::lock_guard<std::mutex> guard(lock_);
+  int64_t current_position = 0;
+  RETURN_NOT_OK(Tell(&current_position));
   RETURN_NOT_OK(Seek(position));
-  return Read(nbytes, bytes_read, out);
+  Status st = Read(nbytes, bytes_read, out);
+  RETURN_NOT_OK(Seek(current_position));
+  return st;
 }
 
 Status RandomAccessFile::ReadAt(
     int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) {
   std::lock_guard<std::mutex> guard(lock_);
+  int64_t current_position = 0;
+  RETURN_NOT_OK(Tell(&current_position));
   RETURN_NOT_OK(Seek(position));
-  return Read(nbytes, out);
+  Status st = Read(nbytes, out);
+  RETURN_NOT_OK(Seek(current_position));
+  return st;
+}
+
+// Gaps smaller than this cost less to read than a separate request
+static constexpr int64_t kDefaultHoleSizeLimit = 8192;
+static constexpr int64_t kDefaultRangeSizeLimit = 32 * 1024 * 1024;
+
+std::vector<ReadRange> CoalesceReadRanges(std::vector<ReadRange> ranges,
+    int64_t hole_size_limit, int64_t range_size_limit) {
+  ranges.erase(std::remove_if(ranges.begin(), ranges.end(),
+                   [](const ReadRange& range) { return range.length == 0; }),
+      ranges.end());
+  std::sort(ranges.begin(), ranges.end(), [](const ReadRange& a, const ReadRange& b) {
+    return a.offset < b.offset;
+  });
+
+  std::vector<ReadRange> coalesced;
+  for (const ReadRange& range : ranges) {
+    if (!coalesced.empty()) {
+      ReadRange& last = coalesced.back();
+      const int64_t last_end = last.offset + last.length;
+      const int64_t end = std::max(last_end, range.offset + range.length);
+      if (range.offset <= last_end + hole_size_limit &&
+          end - last.offset <= range_size_limit) {
+        last.length = end - last.offset;
+        continue;
+      }
+    }
+    coalesced.push_back(range);
+  }
+  return coalesced;
+}
+
+Status RandomAccessFile::ReadRanges(
+    const std::vector<ReadRange>& ranges, std::vector<std::shared_ptr<Buffer>>* out) {
+  std::vector<ReadRange> coalesced =
+      CoalesceReadRanges(ranges, kDefaultHoleSizeLimit, kDefaultRangeSizeLimit);
+  std::vector<std::shared_ptr<Buffer>> coalesced_buffers;
+  RETURN_NOT_OK(ReadCoalescedRanges(coalesced, &coalesced_buffers));
+
+  out->clear();
+  out->reserve(ranges.size());
+  for (const ReadRange& range : ranges) {
+    if (range.length == 0) {
+      out->push_back(std::make_shared<Buffer>(nullptr, 0));
+      continue;
+    }
+
+    // The last coalesced range starting at or before this one contains it
+    auto it = std::upper_bound(coalesced.begin(), coalesced.end(), range.offset,
+        [](int64_t offset, const ReadRange& r) { return offset < r.offset; });
+    DCHECK(it != coalesced.begin());
+    const size_t index = static_cast<size_t>(it - coalesced.begin()) - 1;
+
+    const std::shared_ptr<Buffer>& buffer = coalesced_buffers[index];
+    const int64_t start = range.offset - coalesced[index].offset;
+    const int64_t length =
+        std::max<int64_t>(0, std::min(range.length, buffer->size() - start));
+    if (length == buffer->size()) {
+      out->push_back(buffer);
+    } else if (length > 0) {
+      out->push_back(SliceBuffer(buffer, start, length));
+    } else {
+      out->push_back(std::make_shared<Buffer>(nullptr, 0));
+    }
+  }
+  return Status::OK();
+}
+
+Status RandomAccessFile::ReadCoalescedRanges(
+    const std::vector<ReadRange>& ranges, std::vector<std::shared_ptr<Buffer>>* out) {
+  out->resize(ranges.size());
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    RETURN_NOT_OK(ReadAt(ranges[i].offset, ranges[i].length, &(*out)[i]));
+  }
+  return Status::OK();
 }
 
 Status Writeable::Write(const std::string& data) {
@@ -52,6 +158,13 @@ Status Writeable::Write(const std::string& data) {
       reinterpret_cast<const uint8_t*>(data.c_str()), static_cast<int64_t>(data.size()));
 }
 
+Status Writeable::Writev(const std::vector<std::shared_ptr<Buffer>>& buffers) {
+  for (const auto& buffer : buffers) {
+    RETURN_NOT_OK(Write(buffer->data(), buffer->size()));
+  }
+  return Status::OK();
+}
+
 Status Writeable::Flush() {
   return Status::OK();
 }
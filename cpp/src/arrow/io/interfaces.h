@@ -22,6 +22,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
@@ -73,6 +74,10 @@ class ARROW_EXPORT Writeable {
  public:
   virtual Status Write(const uint8_t* data, int64_t nbytes) = 0;
 
+  /// \brief Write the buffers in order, as one gathered write where the
+  /// stream supports it. The default implementation writes them in turn
+  virtual Status Writev(const std::vector<std::shared_ptr<Buffer>>& buffers);
+
   // Default implementation is a no-op
   virtual Status Flush();
 
@@ -93,29 +98,74 @@ class ARROW_EXPORT OutputStream : virtual public FileInterface, public Writeable
 };
 
 class ARROW_EXPORT InputStream : virtual public FileInterface, public Readable {
+ public:
+  /// \brief Skip over the next nbytes of the stream
+  ///
+  /// The default implementation reads and discards the bytes. Returns IOError
+  /// if the stream ends first
+  virtual Status Advance(int64_t nbytes);
+
  protected:
   InputStream() {}
 };
 
+/// \brief A range of bytes in a file
+struct ARROW_EXPORT ReadRange {
+  int64_t offset;
+  int64_t length;
+};
+
+/// \brief Merge ranges into fewer, larger ones to read instead
+///
+/// Ranges that overlap or are separated by at most hole_size_limit bytes are
+/// merged, as long as the merged range does not grow beyond range_size_limit.
+/// Empty ranges are dropped. The result is sorted by offset
+///
+/// \param[in] ranges the ranges to read, in any order
+/// \param[in] hole_size_limit the largest gap of unneeded bytes worth reading
+/// \param[in] range_size_limit the largest merged range to create
+ARROW_EXPORT
+std::vector<ReadRange> CoalesceReadRanges(std::vector<ReadRange> ranges,
+    int64_t hole_size_limit, int64_t range_size_limit);
+
 class ARROW_EXPORT RandomAccessFile : public InputStream, public Seekable {
  public:
   virtual Status GetSize(int64_t* size) = 0;
 
   virtual bool supports_zero_copy() const = 0;
 
-  /// Read at position, provide default implementations using Read(...), but can
-  /// be overridden
+  /// Seeks past the bytes instead of reading them
+  Status Advance(int64_t nbytes) override;
+
+  /// Read at position without changing the file position, so ReadAt calls
+  /// from several threads do not interfere with each other or with Read.
+  /// Provide default implementations using Read(...), but can be overridden
   ///
-  /// Default implementation is thread-safe
+  /// Default implementation is thread-safe: it seeks, reads and restores the
+  /// position while holding lock()
   virtual Status ReadAt(
       int64_t position, int64_t nbytes, int64_t* bytes_read, uint8_t* out);
 
-  /// Default implementation is thread-safe
+  /// Default implementation is thread-safe and restores the file position
   virtual Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out);
 
+  /// \brief Read several ranges of the file, returning one Buffer per range
+  ///
+  /// Nearby ranges are coalesced with CoalesceReadRanges and read together, so
+  /// the returned Buffers may be slices of a larger read. A range extending
+  /// past the end of the file is truncated. Does not change the file position
+  Status ReadRanges(
+      const std::vector<ReadRange>& ranges, std::vector<std::shared_ptr<Buffer>>* out);
+
   std::mutex& lock() { return lock_; }
 
  protected:
+  /// Read disjoint ranges sorted by offset, as coalesced by ReadRanges. The
+  /// default implementation calls ReadAt for each range in turn; files that can
+  /// issue several reads at once should override it
+  virtual Status ReadCoalescedRanges(
+      const std::vector<ReadRange>& ranges, std::vector<std::shared_ptr<Buffer>>* out);
+
   std::mutex lock_;
 
   RandomAccessFile();
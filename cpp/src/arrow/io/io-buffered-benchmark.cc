@@ -0,0 +1,126 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/api.h"
+#include "arrow/io/buffered.h"
+#include "arrow/io/file.h"
+#include "arrow/test-util.h"
+
+#include "benchmark/benchmark.h"
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace arrow {
+
+// Each iteration writes or reads 4MB in pieces of state.range(0) bytes, which
+// unbuffered is one system call per piece
+constexpr int64_t kTotalSize = 4 * 1024 * 1024;
+constexpr int64_t kBufferSize = 1 << 16;
+
+static const char* kBenchmarkPath = "arrow-io-buffered-benchmark.bin";
+
+static void WriteSmallChunks(benchmark::State& state,  // NOLINT non-const reference
+    bool buffered) {
+  const int64_t chunk_size = state.range(0);
+  std::vector<uint8_t> data(chunk_size);
+  test::random_bytes(chunk_size, 0, data.data());
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<io::FileOutputStream> file;
+    ABORT_NOT_OK(io::FileOutputStream::Open(kBenchmarkPath, &file));
+
+    std::shared_ptr<io::OutputStream> stream = file;
+    if (buffered) {
+      std::shared_ptr<io::BufferedOutputStream> buffered_stream;
+      ABORT_NOT_OK(io::BufferedOutputStream::Create(
+          file, kBufferSize, default_memory_pool(), &buffered_stream));
+      stream = buffered_stream;
+    }
+
+    for (int64_t i = 0; i < kTotalSize; i += chunk_size) {
+      ABORT_NOT_OK(stream->Write(data.data(), chunk_size));
+    }
+    ABORT_NOT_OK(stream->Close());
+  }
+  std::remove(kBenchmarkPath);
+  state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
+}
+
+static void ReadSmallChunks(benchmark::State& state,  // NOLINT non-const reference
+    bool buffered) {
+  const int64_t chunk_size = state.range(0);
+  {
+    std::vector<uint8_t> data(kTotalSize);
+    test::random_bytes(kTotalSize, 0, data.data());
+    std::shared_ptr<io::FileOutputStream> file;
+    ABORT_NOT_OK(io::FileOutputStream::Open(kBenchmarkPath, &file));
+    ABORT_NOT_OK(file->Write(data.data(), kTotalSize));
+    ABORT_NOT_OK(file->Close());
+  }
+
+  std::vector<uint8_t> out(chunk_size);
+  while (state.KeepRunning()) {
+    std::shared_ptr<io::ReadableFile> file;
+    ABORT_NOT_OK(io::ReadableFile::Open(kBenchmarkPath, &file));
+
+    std::shared_ptr<io::InputStream> stream = file;
+    if (buffered) {
+      std::shared_ptr<io::BufferedInputStream> buffered_stream;
+      ABORT_NOT_OK(io::BufferedInputStream::Create(
+          file, kBufferSize, default_memory_pool(), &buffered_stream));
+      stream = buffered_stream;
+    }
+
+    int64_t bytes_read;
+    for (int64_t i = 0; i < kTotalSize; i += chunk_size) {
+      ABORT_NOT_OK(stream->Read(chunk_size, &bytes_read, out.data()));
+    }
+    ABORT_NOT_OK(stream->Close());
+  }
+  std::remove(kBenchmarkPath);
+  state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
+}
+
+static void BM_FileOutputStreamSmallWrites(
+    benchmark::State& state) {  // NOLINT non-const reference
+  WriteSmallChunks(state, false);
+}
+
+static void BM_BufferedOutputStreamSmallWrites(
+    benchmark::State& state) {  // NOLINT non-const reference
+  WriteSmallChunks(state, true);
+}
+
+static void BM_ReadableFileSmallReads(
+    benchmark::State& state) {  // NOLINT non-const reference
+  ReadSmallChunks(state, false);
+}
+
+static void BM_BufferedInputStreamSmallReads(
+    benchmark::State& state) {  // NOLINT non-const reference
+  ReadSmallChunks(state, true);
+}
+
+BENCHMARK(BM_FileOutputStreamSmallWrites)->RangeMultiplier(8)->Range(8, 4096);
+BENCHMARK(BM_BufferedOutputStreamSmallWrites)->RangeMultiplier(8)->Range(8, 4096);
+BENCHMARK(BM_ReadableFileSmallReads)->RangeMultiplier(8)->Range(8, 4096);
+BENCHMARK(BM_BufferedInputStreamSmallReads)->RangeMultiplier(8)->Range(8, 4096);
+
+}  // namespace arrow
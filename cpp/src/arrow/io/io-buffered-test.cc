@@ -0,0 +1,296 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "arrow/io/buffered.h"
+#include "arrow/io/memory.h"
+#include "arrow/io/test-common.h"
+
+namespace arrow {
+namespace io {
+
+// Counts the calls made on the wrapped stream
+class CountingOutputStream : public OutputStream {
+ public:
+  explicit CountingOutputStream(const std::shared_ptr<OutputStream>& raw)
+      : raw_(raw), num_writes_(0), num_flushes_(0), closed_(false) {}
+
+  Status Close() override {
+    closed_ = true;
+    return raw_->Close();
+  }
+  Status Tell(int64_t* position) override { return raw_->Tell(position); }
+  Status Write(const uint8_t* data, int64_t nbytes) override {
+    ++num_writes_;
+    return raw_->Write(data, nbytes);
+  }
+  Status Writev(const std::vector<std::shared_ptr<Buffer>>& buffers) override {
+    ++num_writes_;
+    return raw_->Writev(buffers);
+  }
+  Status Flush() override {
+    ++num_flushes_;
+    return raw_->Flush();
+  }
+
+  int num_writes() const { return num_writes_; }
+  int num_flushes() const { return num_flushes_; }
+  bool closed() const { return closed_; }
+
+ private:
+  std::shared_ptr<OutputStream> raw_;
+  int num_writes_;
+  int num_flushes_;
+  bool closed_;
+};
+
+class CountingInputStream : public InputStream {
+ public:
+  explicit CountingInputStream(const std::shared_ptr<InputStream>& raw)
+      : raw_(raw), num_reads_(0) {}
+
+  Status Close() override { return raw_->Close(); }
+  Status Tell(int64_t* position) override { return raw_->Tell(position); }
+  Status Read(int64_t nbytes, int64_t* bytes_read, uint8_t* out) override {
+    ++num_reads_;
+    return raw_->Read(nbytes, bytes_read, out);
+  }
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    ++num_reads_;
+    return raw_->Read(nbytes, out);
+  }
+
+  int num_reads() const { return num_reads_; }
+
+ private:
+  std::shared_ptr<InputStream> raw_;
+  int num_reads_;
+};
+
+class TestBufferedOutputStream : public ::testing::Test {
+ public:
+  void SetUp() {
+    std::shared_ptr<BufferOutputStream> sink;
+    ASSERT_OK(BufferOutputStream::Create(0, default_memory_pool(), &sink));
+    sink_ = sink;
+    raw_ = std::make_shared<CountingOutputStream>(sink_);
+  }
+
+  void MakeStream(int64_t buffer_size) {
+    ASSERT_OK(
+        BufferedOutputStream::Create(raw_, buffer_size, default_memory_pool(), &stream_));
+  }
+
+  void CheckContents(const std::string& expected) {
+    std::shared_ptr<Buffer> result;
+    ASSERT_OK(sink_->Finish(&result));
+    ASSERT_EQ(static_cast<int64_t>(expected.size()), result->size());
+    ASSERT_EQ(0, std::memcmp(result->data(), expected.c_str(), expected.size()));
+  }
+
+ protected:
+  std::shared_ptr<BufferOutputStream> sink_;
+  std::shared_ptr<CountingOutputStream> raw_;
+  std::shared_ptr<BufferedOutputStream> stream_;
+};
+
+TEST_F(TestBufferedOutputStream, CoalescesSmallWrites) {
+  MakeStream(100);
+
+  std::string expected;
+  for (int i = 0; i < 50; ++i) {
+    std::string data = "data" + std::to_string(i);
+    ASSERT_OK(stream_->Write(data));
+    expected += data;
+  }
+
+  int64_t position;
+  ASSERT_OK(stream_->Tell(&position));
+  ASSERT_EQ(static_cast<int64_t>(expected.size()), position);
+
+  ASSERT_OK(stream_->Close());
+  ASSERT_TRUE(raw_->closed());
+
+  // 290 bytes in buffers of 100
+  ASSERT_EQ(3, raw_->num_writes());
+  CheckContents(expected);
+}
+
+TEST_F(TestBufferedOutputStream, LargeWritesPassThrough) {
+  MakeStream(100);
+
+  std::string small = "small";
+  std::string large(250, 'x');
+
+  ASSERT_OK(stream_->Write(small));
+  ASSERT_OK(stream_->Write(large));
+
+  // The buffered bytes are written first, then the large write is not copied
+  ASSERT_EQ(2, raw_->num_writes());
+
+  ASSERT_OK(stream_->Write(small));
+  ASSERT_EQ(2, raw_->num_writes());
+
+  ASSERT_OK(stream_->Flush());
+  ASSERT_EQ(3, raw_->num_writes());
+  ASSERT_EQ(1, raw_->num_flushes());
+
+  // Nothing buffered, nothing to write
+  ASSERT_OK(stream_->Flush());
+  ASSERT_EQ(3, raw_->num_writes());
+
+  CheckContents(small + large + small);
+}
+
+TEST_F(TestBufferedOutputStream, Writev) {
+  MakeStream(100);
+
+  std::string small = "small";
+  std::string large(250, 'x');
+  auto small_buffer =
+      std::make_shared<Buffer>(reinterpret_cast<const uint8_t*>(small.c_str()),
+          static_cast<int64_t>(small.size()));
+  auto large_buffer =
+      std::make_shared<Buffer>(reinterpret_cast<const uint8_t*>(large.c_str()),
+          static_cast<int64_t>(large.size()));
+
+  ASSERT_OK(stream_->Writev({small_buffer, small_buffer}));
+  ASSERT_EQ(0, raw_->num_writes());
+
+  // The buffered bytes are written with the buffers in one gathered write
+  ASSERT_OK(stream_->Writev({small_buffer, large_buffer}));
+  ASSERT_EQ(1, raw_->num_writes());
+
+  int64_t position;
+  ASSERT_OK(stream_->Tell(&position));
+  ASSERT_EQ(265, position);
+
+  // Exactly filling the buffer flushes it, as with Write
+  std::string exact(100, 'y');
+  auto exact_buffer =
+      std::make_shared<Buffer>(reinterpret_cast<const uint8_t*>(exact.c_str()),
+          static_cast<int64_t>(exact.size()));
+  ASSERT_OK(stream_->Writev({exact_buffer}));
+  ASSERT_EQ(2, raw_->num_writes());
+
+  ASSERT_OK(stream_->Close());
+  ASSERT_EQ(2, raw_->num_writes());
+  CheckContents(small + small + small + large + exact);
+}
+
+TEST_F(TestBufferedOutputStream, DtorFlushes) {
+  MakeStream(1000);
+  ASSERT_OK(stream_->Write(std::string("data")));
+  ASSERT_EQ(0, raw_->num_writes());
+
+  stream_.reset();
+  ASSERT_EQ(1, raw_->num_writes());
+  ASSERT_FALSE(raw_->closed());
+  CheckContents("data");
+}
+
+TEST_F(TestBufferedOutputStream, InvalidBufferSize) {
+  ASSERT_RAISES(
+      Invalid, BufferedOutputStream::Create(raw_, 0, default_memory_pool(), &stream_));
+}
+
+class TestBufferedInputStream : public ::testing::Test {
+ public:
+  void MakeStream(const std::string& data, int64_t buffer_size) {
+    data_ = data;
+    auto reader = std::make_shared<BufferReader>(
+        reinterpret_cast<const uint8_t*>(data_.c_str()), data_.size());
+    raw_ = std::make_shared<CountingInputStream>(reader);
+    ASSERT_OK(
+        BufferedInputStream::Create(raw_, buffer_size, default_memory_pool(), &stream_));
+  }
+
+ protected:
+  std::string data_;
+  std::shared_ptr<CountingInputStream> raw_;
+  std::shared_ptr<BufferedInputStream> stream_;
+};
+
+TEST_F(TestBufferedInputStream, CoalescesSmallReads) {
+  std::string data;
+  for (int i = 0; i < 100; ++i) {
+    data += std::to_string(i);
+  }
+  MakeStream(data, 64);
+
+  std::string result;
+  uint8_t out[7];
+  int64_t bytes_read;
+  do {
+    ASSERT_OK(stream_->Read(7, &bytes_read, out));
+    result.append(reinterpret_cast<const char*>(out), bytes_read);
+  } while (bytes_read > 0);
+
+  ASSERT_EQ(data, result);
+
+  // 190 bytes in buffers of 64, plus one read at the end of the stream for each
+  // of the last two calls
+  ASSERT_EQ(5, raw_->num_reads());
+
+  int64_t position;
+  ASSERT_OK(stream_->Tell(&position));
+  ASSERT_EQ(static_cast<int64_t>(data.size()), position);
+}
+
+TEST_F(TestBufferedInputStream, LargeReadsPassThrough) {
+  std::string data(1000, 'x');
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<char>(i % 128);
+  }
+  MakeStream(data, 100);
+
+  std::vector<uint8_t> out(1000);
+  int64_t bytes_read;
+  ASSERT_OK(stream_->Read(10, &bytes_read, out.data()));
+  ASSERT_EQ(1, raw_->num_reads());
+  ASSERT_EQ(90, stream_->bytes_buffered());
+
+  int64_t position;
+  ASSERT_OK(stream_->Tell(&position));
+  ASSERT_EQ(10, position);
+
+  // Drains the buffer, then reads the rest directly
+  ASSERT_OK(stream_->Read(500, &bytes_read, out.data() + 10));
+  ASSERT_EQ(500, bytes_read);
+  ASSERT_EQ(2, raw_->num_reads());
+  ASSERT_EQ(0, stream_->bytes_buffered());
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(stream_->Read(1000, &buffer));
+  ASSERT_EQ(490, buffer->size());
+  std::memcpy(out.data() + 510, buffer->data(), 490);
+
+  ASSERT_EQ(0, std::memcmp(out.data(), data.c_str(), 1000));
+
+  ASSERT_OK(stream_->Tell(&position));
+  ASSERT_EQ(1000, position);
+}
+
+}  // namespace io
+}  // namespace arrow
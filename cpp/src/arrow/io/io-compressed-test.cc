@@ -0,0 +1,189 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "arrow/io/compressed.h"
+#include "arrow/io/memory.h"
+#include "arrow/io/test-common.h"
+
+namespace arrow {
+namespace io {
+
+// Random bytes repeated, so that all codecs shrink them
+static std::vector<uint8_t> MakeCompressibleData(int64_t size) {
+  std::vector<uint8_t> pattern(1000);
+  test::random_bytes(pattern.size(), 0, pattern.data());
+  std::vector<uint8_t> data(size);
+  for (int64_t i = 0; i < size; ++i) {
+    data[i] = pattern[i % pattern.size()];
+  }
+  return data;
+}
+
+class TestCompressedStreams : public ::testing::Test {
+ public:
+  void SetUp() {
+    data_ = MakeCompressibleData(100000);
+    ASSERT_OK(BufferOutputStream::Create(0, default_memory_pool(), &sink_));
+  }
+
+  void WriteCompressed(Compression::type compression, int64_t block_size) {
+    std::shared_ptr<CompressedOutputStream> stream;
+    ASSERT_OK(CompressedOutputStream::Create(
+        compression, sink_, block_size, default_memory_pool(), &stream));
+
+    // Writes smaller and larger than a block
+    int64_t offset = 0;
+    int64_t nbytes = 1;
+    while (offset < static_cast<int64_t>(data_.size())) {
+      nbytes = std::min(nbytes * 3, static_cast<int64_t>(data_.size()) - offset);
+      ASSERT_OK(stream->Write(data_.data() + offset, nbytes));
+      offset += nbytes;
+    }
+
+    int64_t position;
+    ASSERT_OK(stream->Tell(&position));
+    ASSERT_EQ(static_cast<int64_t>(data_.size()), position);
+    ASSERT_OK(stream->Close());
+    ASSERT_OK(sink_->Finish(&compressed_));
+  }
+
+  void MakeInputStream(Compression::type compression) {
+    auto reader = std::make_shared<BufferReader>(compressed_);
+    ASSERT_OK(CompressedInputStream::Create(
+        compression, reader, default_memory_pool(), &input_));
+  }
+
+  void CheckRoundtrip(Compression::type compression) {
+    ASSERT_OK(BufferOutputStream::Create(0, default_memory_pool(), &sink_));
+    WriteCompressed(compression, 10000);
+    MakeInputStream(compression);
+
+    std::vector<uint8_t> out(data_.size());
+    int64_t offset = 0;
+    int64_t bytes_read;
+    do {
+      ASSERT_OK(input_->Read(7777, &bytes_read, out.data() + offset));
+      offset += bytes_read;
+    } while (bytes_read > 0);
+
+    ASSERT_EQ(static_cast<int64_t>(data_.size()), offset);
+    ASSERT_EQ(0, std::memcmp(out.data(), data_.data(), data_.size()));
+
+    int64_t position;
+    ASSERT_OK(input_->Tell(&position));
+    ASSERT_EQ(static_cast<int64_t>(data_.size()), position);
+  }
+
+ protected:
+  std::vector<uint8_t> data_;
+  std::shared_ptr<BufferOutputStream> sink_;
+  std::shared_ptr<Buffer> compressed_;
+  std::shared_ptr<CompressedInputStream> input_;
+};
+
+TEST_F(TestCompressedStreams, Roundtrip) {
+  for (auto compression : {Compression::SNAPPY, Compression::GZIP,
+           Compression::BROTLI, Compression::ZSTD, Compression::LZ4}) {
+    CheckRoundtrip(compression);
+  }
+}
+
+TEST_F(TestCompressedStreams, ZeroCopyReads) {
+  WriteCompressed(Compression::ZSTD, 10000);
+  ASSERT_LT(compressed_->size(), static_cast<int64_t>(data_.size()) / 5);
+  MakeInputStream(Compression::ZSTD);
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(input_->Read(100, &buffer));
+  ASSERT_EQ(100, buffer->size());
+  ASSERT_TRUE(buffer->parent() != nullptr);
+  ASSERT_EQ(0, std::memcmp(buffer->data(), data_.data(), 100));
+
+  // Spans blocks, so it is a copy
+  ASSERT_OK(input_->Read(15000, &buffer));
+  ASSERT_EQ(15000, buffer->size());
+  ASSERT_EQ(0, std::memcmp(buffer->data(), data_.data() + 100, 15000));
+
+  ASSERT_OK(input_->Read(1000000, &buffer));
+  ASSERT_EQ(static_cast<int64_t>(data_.size()) - 15100, buffer->size());
+
+  ASSERT_OK(input_->Read(10, &buffer));
+  ASSERT_EQ(0, buffer->size());
+}
+
+TEST_F(TestCompressedStreams, FlushWritesPartialBlock) {
+  std::shared_ptr<CompressedOutputStream> stream;
+  ASSERT_OK(CompressedOutputStream::Create(
+      Compression::LZ4, sink_, 1 << 20, default_memory_pool(), &stream));
+
+  ASSERT_OK(stream->Write(data_.data(), 500));
+  int64_t position;
+  ASSERT_OK(sink_->Tell(&position));
+  ASSERT_EQ(0, position);
+
+  ASSERT_OK(stream->Flush());
+  ASSERT_OK(sink_->Tell(&position));
+  ASSERT_GT(position, 0);
+
+  ASSERT_OK(stream->Write(data_.data() + 500, 1500));
+  ASSERT_OK(stream->Close());
+  ASSERT_OK(sink_->Finish(&compressed_));
+  MakeInputStream(Compression::LZ4);
+
+  std::vector<uint8_t> out(2000);
+  int64_t bytes_read;
+  ASSERT_OK(input_->Read(5000, &bytes_read, out.data()));
+  ASSERT_EQ(2000, bytes_read);
+  ASSERT_EQ(0, std::memcmp(out.data(), data_.data(), 2000));
+}
+
+TEST_F(TestCompressedStreams, TruncatedStream) {
+  WriteCompressed(Compression::GZIP, 10000);
+
+  for (int64_t truncated_size : {4, 20}) {
+    auto reader =
+        std::make_shared<BufferReader>(SliceBuffer(compressed_, 0, truncated_size));
+    ASSERT_OK(CompressedInputStream::Create(
+        Compression::GZIP, reader, default_memory_pool(), &input_));
+
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_RAISES(IOError, input_->Read(100, &buffer));
+  }
+}
+
+TEST_F(TestCompressedStreams, InvalidArguments) {
+  std::shared_ptr<CompressedOutputStream> stream;
+  ASSERT_RAISES(Invalid, CompressedOutputStream::Create(Compression::UNCOMPRESSED, sink_,
+                             1000, default_memory_pool(), &stream));
+  ASSERT_RAISES(Invalid, CompressedOutputStream::Create(Compression::ZSTD, sink_, 0,
+                             default_memory_pool(), &stream));
+
+  auto reader = std::make_shared<BufferReader>(nullptr, 0);
+  ASSERT_RAISES(Invalid, CompressedInputStream::Create(Compression::UNCOMPRESSED,
+                             reader, default_memory_pool(), &input_));
+}
+
+}  // namespace io
+}  // namespace arrow
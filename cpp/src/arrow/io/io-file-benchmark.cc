@@ -0,0 +1,110 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/api.h"
+#include "arrow/io/file.h"
+#include "arrow/test-util.h"
+
+#include "benchmark/benchmark.h"
+
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace arrow {
+
+constexpr int64_t kFileSize = 64 * 1024 * 1024;  // 64MB
+
+// A file of random bytes shared by all benchmarks, removed at exit
+class BenchmarkFile {
+ public:
+  BenchmarkFile() : path_("arrow-io-file-benchmark.bin") {
+    std::vector<uint8_t> data(kFileSize);
+    test::random_bytes(kFileSize, 0, data.data());
+
+    std::shared_ptr<io::FileOutputStream> out;
+    ABORT_NOT_OK(io::FileOutputStream::Open(path_, &out));
+    ABORT_NOT_OK(out->Write(data.data(), kFileSize));
+    ABORT_NOT_OK(out->Close());
+
+    ABORT_NOT_OK(io::ReadableFile::Open(path_, &file_));
+    ABORT_NOT_OK(io::MemoryMappedFile::Open(path_, io::FileMode::READ, &mmap_));
+  }
+
+  ~BenchmarkFile() {
+    file_.reset();
+    mmap_.reset();
+    std::remove(path_.c_str());
+  }
+
+  std::shared_ptr<io::ReadableFile> file() const { return file_; }
+  std::shared_ptr<io::MemoryMappedFile> mmap() const { return mmap_; }
+
+ private:
+  std::string path_;
+  std::shared_ptr<io::ReadableFile> file_;
+  std::shared_ptr<io::MemoryMappedFile> mmap_;
+};
+
+static const BenchmarkFile& GetBenchmarkFile() {
+  static BenchmarkFile file;
+  return file;
+}
+
+// Each thread reads blocks of state.range(0) bytes at random positions from the
+// same file object
+static void RandomReadAt(benchmark::State& state,  // NOLINT non-const reference
+    io::RandomAccessFile* file) {
+  const int64_t block_size = state.range(0);
+  const int64_t num_blocks = kFileSize / block_size;
+
+  std::mt19937 gen(std::random_device{}());
+  std::uniform_int_distribution<int64_t> dist(0, num_blocks - 1);
+
+  std::shared_ptr<Buffer> buffer;
+  while (state.KeepRunning()) {
+    ABORT_NOT_OK(file->ReadAt(dist(gen) * block_size, block_size, &buffer));
+    benchmark::DoNotOptimize(buffer->data()[0]);
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * block_size);
+}
+
+static void BM_ReadableFileRandomReadAt(
+    benchmark::State& state) {  // NOLINT non-const reference
+  RandomReadAt(state, GetBenchmarkFile().file().get());
+}
+
+static void BM_MemoryMappedFileRandomReadAt(
+    benchmark::State& state) {  // NOLINT non-const reference
+  RandomReadAt(state, GetBenchmarkFile().mmap().get());
+}
+
+BENCHMARK(BM_ReadableFileRandomReadAt)
+    ->RangeMultiplier(16)
+    ->Range(4 * 1024, 1024 * 1024)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+BENCHMARK(BM_MemoryMappedFileRandomReadAt)
+    ->RangeMultiplier(16)
+    ->Range(4 * 1024, 1024 * 1024)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+}  // namespace arrow
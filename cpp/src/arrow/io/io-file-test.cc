@@ -15,7 +15,9 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <atomic>
+#include <cerrno>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
@@ -27,6 +29,12 @@
 #include <sstream>
 #include <string>
 #include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 #include "gtest/gtest.h"
 
@@ -148,6 +156,34 @@ TEST_F(TestFileOutputStream, InvalidWrites) {
   ASSERT_RAISES(IOError, file_->Write(reinterpret_cast<const uint8_t*>(data), -1));
 }
 
+TEST_F(TestFileOutputStream, Writev) {
+  OpenFile();
+
+  std::vector<uint8_t> data(5000);
+  test::random_bytes(data.size(), 0, data.data());
+
+  // More buffers than one writev call accepts, some of them empty
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  for (int64_t offset = 0; offset < static_cast<int64_t>(data.size()); offset += 2) {
+    buffers.push_back(std::make_shared<Buffer>(data.data() + offset, 2));
+    buffers.push_back(std::make_shared<Buffer>(nullptr, 0));
+  }
+  ASSERT_OK(file_->Writev(buffers));
+  ASSERT_OK(file_->Writev({}));
+
+  int64_t position;
+  ASSERT_OK(file_->Tell(&position));
+  ASSERT_EQ(static_cast<int64_t>(data.size()), position);
+  ASSERT_OK(file_->Close());
+
+  std::shared_ptr<ReadableFile> rd_file;
+  ASSERT_OK(ReadableFile::Open(path_, &rd_file));
+  std::shared_ptr<Buffer> contents;
+  ASSERT_OK(rd_file->Read(10000, &contents));
+  ASSERT_EQ(static_cast<int64_t>(data.size()), contents->size());
+  ASSERT_EQ(0, std::memcmp(contents->data(), data.data(), data.size()));
+}
+
 TEST_F(TestFileOutputStream, Tell) {
   OpenFile();
 
@@ -288,30 +324,157 @@ TEST_F(TestReadableFile, ReadAt) {
   ASSERT_EQ(4, bytes_read);
   ASSERT_EQ(0, std::memcmp(buffer, "test", 4));
 
-  // position advanced
+  // position unchanged
   ASSERT_OK(file_->Tell(&position));
-  ASSERT_EQ(4, position);
+  ASSERT_EQ(0, position);
 
   ASSERT_OK(file_->ReadAt(4, 10, &bytes_read, buffer));
   ASSERT_EQ(4, bytes_read);
   ASSERT_EQ(0, std::memcmp(buffer, "data", 4));
 
-  // position advanced to EOF
+  // Reading past EOF returns no bytes
+  ASSERT_OK(file_->ReadAt(10, 4, &bytes_read, buffer));
+  ASSERT_EQ(0, bytes_read);
+
   ASSERT_OK(file_->Tell(&position));
-  ASSERT_EQ(8, position);
+  ASSERT_EQ(0, position);
 
   // Check buffer API
   std::shared_ptr<Buffer> buffer2;
 
+  ASSERT_OK(file_->Seek(2));
   ASSERT_OK(file_->ReadAt(0, 4, &buffer2));
   ASSERT_EQ(4, buffer2->size());
 
   Buffer expected(reinterpret_cast<const uint8_t*>(test_data), 4);
   ASSERT_TRUE(buffer2->Equals(expected));
 
-  // position advanced
+  // position unchanged, so sequential reads continue where they left off
   ASSERT_OK(file_->Tell(&position));
-  ASSERT_EQ(4, position);
+  ASSERT_EQ(2, position);
+  ASSERT_OK(file_->Read(2, &bytes_read, buffer));
+  ASSERT_EQ(0, std::memcmp(buffer, "st", 2));
+
+  ASSERT_RAISES(Invalid, file_->ReadAt(-1, 4, &buffer2));
+}
+
+TEST_F(TestReadableFile, DirectIO) {
+  // Spans several bounce buffers and ends in a partial block
+  const int64_t size = (10 << 20) + 123;
+  std::vector<uint8_t> data(size);
+  test::random_bytes(size, 0, data.data());
+  {
+    std::shared_ptr<FileOutputStream> out;
+    ASSERT_OK(FileOutputStream::Open(path_, &out));
+    ASSERT_OK(out->Write(data.data(), size));
+    ASSERT_OK(out->Close());
+  }
+
+  Status st = ReadableFile::Open(path_, default_memory_pool(), true, &file_);
+  if (st.IsNotImplemented()) { return; }
+#if defined(O_DIRECT)
+  if (!st.ok()) {
+    // Some file systems, such as tmpfs, refuse O_DIRECT
+    const int fd = open(path_.c_str(), O_RDONLY | O_DIRECT);
+    if (fd == -1 && errno == EINVAL) { return; }
+    if (fd != -1) { close(fd); }
+  }
+#endif
+  ASSERT_OK(st);
+
+  // Whole file in one read
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file_->Read(size + 100, &buffer));
+  ASSERT_EQ(size, buffer->size());
+  ASSERT_EQ(0, std::memcmp(buffer->data(), data.data(), size));
+
+  int64_t position;
+  ASSERT_OK(file_->Tell(&position));
+  ASSERT_EQ(size, position);
+
+  // Sequential reads at unaligned positions and lengths
+  ASSERT_OK(file_->Seek(7));
+  int64_t offset = 7;
+  std::vector<uint8_t> out(100000);
+  int64_t bytes_read;
+  while (offset < size) {
+    ASSERT_OK(file_->Read(99991, &bytes_read, out.data()));
+    ASSERT_EQ(std::min<int64_t>(99991, size - offset), bytes_read);
+    ASSERT_EQ(0, std::memcmp(out.data(), data.data() + offset, bytes_read));
+    offset += bytes_read;
+  }
+  ASSERT_OK(file_->Read(10, &bytes_read, out.data()));
+  ASSERT_EQ(0, bytes_read);
+
+  // Positional reads
+  ASSERT_OK(file_->ReadAt(4095, 2, &bytes_read, out.data()));
+  ASSERT_EQ(2, bytes_read);
+  ASSERT_EQ(0, std::memcmp(out.data(), data.data() + 4095, 2));
+
+  ASSERT_OK(file_->ReadAt(size - 50, 100, &buffer));
+  ASSERT_EQ(50, buffer->size());
+  ASSERT_EQ(0, std::memcmp(buffer->data(), data.data() + size - 50, 50));
+
+  ASSERT_OK(file_->ReadAt(size + 5000, 100, &buffer));
+  ASSERT_EQ(0, buffer->size());
+}
+
+TEST_F(TestReadableFile, DISABLED_ReadWriteOver2GbBlock) {
+  // A single Read or Write larger than the largest transfer of one system call
+  const int64_t size = (static_cast<int64_t>(1) << 31) + 1000;
+  std::vector<uint8_t> data(size);
+  test::random_bytes(1000, 0, data.data() + size - 1000);
+  {
+    std::shared_ptr<FileOutputStream> out;
+    ASSERT_OK(FileOutputStream::Open(path_, &out));
+    ASSERT_OK(out->Write(data.data(), size));
+    ASSERT_OK(out->Close());
+  }
+
+  OpenFile();
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file_->Read(size, &buffer));
+  ASSERT_EQ(size, buffer->size());
+  ASSERT_EQ(0, std::memcmp(buffer->data(), data.data(), size));
+}
+
+TEST_F(TestReadableFile, ReadRanges) {
+  const int64_t size = 1 << 20;
+  std::vector<uint8_t> data(size);
+  test::random_bytes(size, 0, data.data());
+  {
+    std::shared_ptr<FileOutputStream> out;
+    ASSERT_OK(FileOutputStream::Open(path_, &out));
+    ASSERT_OK(out->Write(data.data(), size));
+    ASSERT_OK(out->Close());
+  }
+  OpenFile();
+
+  // Some ranges close enough to coalesce, and some far apart
+  std::vector<ReadRange> ranges;
+  for (int64_t offset = 0; offset < size; offset += 100000) {
+    ranges.push_back({offset, 1000});
+    ranges.push_back({offset + 1500, 3000});
+  }
+  ranges.push_back({size - 10, 100});
+
+  for (int num_threads : {1, 4}) {
+    file_->set_read_threads(num_threads);
+
+    std::vector<std::shared_ptr<Buffer>> buffers;
+    ASSERT_OK(file_->ReadRanges(ranges, &buffers));
+    ASSERT_EQ(ranges.size(), buffers.size());
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      const int64_t length = std::min(ranges[i].length, size - ranges[i].offset);
+      ASSERT_EQ(length, buffers[i]->size());
+      ASSERT_EQ(0, std::memcmp(buffers[i]->data(), data.data() + ranges[i].offset,
+                       static_cast<size_t>(length)));
+    }
+  }
+
+  int64_t position;
+  ASSERT_OK(file_->Tell(&position));
+  ASSERT_EQ(0, position);
 }
 
 TEST_F(TestReadableFile, NonExistentFile) {
@@ -395,6 +558,47 @@ TEST_F(TestReadableFile, ThreadSafety) {
   ASSERT_EQ(niter * 2, correct_count);
 }
 
+TEST_F(TestReadableFile, ReadAtDoesNotMoveCursor) {
+  std::string data = "0123456789abcdefghijklmnopqrstuvwxyz";
+  {
+    std::ofstream stream;
+    stream.open(path_.c_str());
+    stream << data;
+  }
+  OpenFile();
+
+  std::atomic<bool> done(false);
+  std::atomic<int> correct_count(0);
+
+  // Positional reads from other threads must not disturb sequential reads
+  auto ReadData = [&done, &correct_count, &data, this]() {
+    uint8_t buffer[4];
+    int64_t bytes_read;
+    while (!done) {
+      ASSERT_OK(file_->ReadAt(30, 4, &bytes_read, buffer));
+      if (0 == memcmp(data.c_str() + 30, buffer, 4)) { correct_count += 1; }
+    }
+  };
+  std::thread thread1(ReadData);
+  std::thread thread2(ReadData);
+
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_OK(file_->Seek(0));
+    for (int64_t j = 0; j < static_cast<int64_t>(data.size()); ++j) {
+      uint8_t c;
+      int64_t bytes_read;
+      ASSERT_OK(file_->Read(1, &bytes_read, &c));
+      ASSERT_EQ(1, bytes_read);
+      ASSERT_EQ(data[j], c);
+    }
+  }
+  done = true;
+
+  thread1.join();
+  thread2.join();
+  ASSERT_GT(correct_count, 0);
+}
+
 // ----------------------------------------------------------------------
 // Memory map tests
 
@@ -429,6 +633,43 @@ TEST_F(TestMemoryMappedFile, WriteRead) {
   }
 }
 
+TEST_F(TestMemoryMappedFile, ReadAt) {
+  const int64_t buffer_size = 1024;
+  std::vector<uint8_t> buffer(buffer_size);
+  test::random_bytes(1024, 0, buffer.data());
+
+  std::string path = "ipc-read-at-test";
+  std::shared_ptr<MemoryMappedFile> result;
+  ASSERT_OK(InitMemoryMap(buffer_size, path, &result));
+  ASSERT_OK(result->Write(buffer.data(), buffer_size));
+  ASSERT_OK(result->Seek(10));
+
+  // Zero copy slice of the map
+  std::shared_ptr<Buffer> out_buffer;
+  ASSERT_OK(result->ReadAt(100, 200, &out_buffer));
+  ASSERT_EQ(200, out_buffer->size());
+  ASSERT_EQ(0, memcmp(out_buffer->data(), buffer.data() + 100, 200));
+  ASSERT_TRUE(out_buffer->parent() != nullptr);
+
+  // Truncated at end of file
+  ASSERT_OK(result->ReadAt(buffer_size - 24, 100, &out_buffer));
+  ASSERT_EQ(24, out_buffer->size());
+  ASSERT_OK(result->ReadAt(buffer_size + 1, 100, &out_buffer));
+  ASSERT_EQ(0, out_buffer->size());
+
+  uint8_t out[16];
+  int64_t bytes_read;
+  ASSERT_OK(result->ReadAt(500, 16, &bytes_read, out));
+  ASSERT_EQ(16, bytes_read);
+  ASSERT_EQ(0, memcmp(out, buffer.data() + 500, 16));
+
+  ASSERT_RAISES(Invalid, result->ReadAt(-1, 16, &bytes_read, out));
+
+  int64_t position;
+  ASSERT_OK(result->Tell(&position));
+  ASSERT_EQ(10, position);
+}
+
 TEST_F(TestMemoryMappedFile, ReadOnly) {
   const int64_t buffer_size = 1024;
   std::vector<uint8_t> buffer(buffer_size);
@@ -497,6 +738,179 @@ TEST_F(TestMemoryMappedFile, DISABLED_ReadWriteOver4GbFile) {
   ASSERT_OK(rommap->Close());
 }
 
+TEST_F(TestMemoryMappedFile, WriteGrowsFile) {
+  const int64_t buffer_size = 1000;
+  std::vector<uint8_t> buffer(buffer_size);
+  test::random_bytes(buffer_size, 0, buffer.data());
+
+  const int reps = 10;
+
+  std::string path = "ipc-grow-test";
+  std::shared_ptr<MemoryMappedFile> rwmmap;
+  ASSERT_OK(InitMemoryMap(0, path, &rwmmap));
+
+  for (int i = 0; i < reps; ++i) {
+    ASSERT_OK(rwmmap->Write(buffer.data(), buffer_size));
+  }
+  int64_t size;
+  ASSERT_OK(rwmmap->GetSize(&size));
+  ASSERT_EQ(reps * buffer_size, size);
+
+  // Grows past a hole left by seeking
+  ASSERT_OK(rwmmap->WriteAt(reps * buffer_size + 500, buffer.data(), 10));
+  ASSERT_OK(rwmmap->GetSize(&size));
+  ASSERT_EQ(reps * buffer_size + 510, size);
+
+  // The space reserved for growing is given back
+  ASSERT_OK(rwmmap->Close());
+  rwmmap.reset();
+
+  std::shared_ptr<MemoryMappedFile> rommap;
+  ASSERT_OK(MemoryMappedFile::Open(path, FileMode::READ, &rommap));
+  ASSERT_OK(rommap->GetSize(&size));
+  ASSERT_EQ(reps * buffer_size + 510, size);
+
+  std::shared_ptr<Buffer> out_buffer;
+  for (int i = 0; i < reps; ++i) {
+    ASSERT_OK(rommap->ReadAt(i * buffer_size, buffer_size, &out_buffer));
+    ASSERT_EQ(0, memcmp(out_buffer->data(), buffer.data(), buffer_size));
+  }
+}
+
+TEST_F(TestMemoryMappedFile, Resize) {
+  std::string data = "foobar";
+  std::string path = "ipc-resize-test";
+  std::shared_ptr<MemoryMappedFile> rwmmap;
+  ASSERT_OK(InitMemoryMap(static_cast<int64_t>(data.size()), path, &rwmmap));
+  ASSERT_OK(rwmmap->Write(
+      reinterpret_cast<const uint8_t*>(data.c_str()), static_cast<int64_t>(data.size())));
+
+  ASSERT_OK(rwmmap->Resize(1 << 20));
+  int64_t size;
+  ASSERT_OK(rwmmap->GetSize(&size));
+  ASSERT_EQ(1 << 20, size);
+
+  std::shared_ptr<Buffer> out_buffer;
+  ASSERT_OK(rwmmap->ReadAt(0, 6, &out_buffer));
+  ASSERT_EQ(0, memcmp(out_buffer->data(), data.c_str(), 6));
+
+  // Cannot shrink under a live Buffer
+  ASSERT_RAISES(IOError, rwmmap->Resize(3));
+  out_buffer.reset();
+  ASSERT_OK(rwmmap->Resize(3));
+  ASSERT_OK(rwmmap->GetSize(&size));
+  ASSERT_EQ(3, size);
+
+  ASSERT_RAISES(Invalid, rwmmap->Resize(-1));
+  ASSERT_OK(rwmmap->Close());
+
+  std::shared_ptr<ReadableFile> file;
+  ASSERT_OK(ReadableFile::Open(path, &file));
+  ASSERT_OK(file->GetSize(&size));
+  ASSERT_EQ(3, size);
+
+  std::shared_ptr<MemoryMappedFile> rommap;
+  ASSERT_OK(MemoryMappedFile::Open(path, FileMode::READ, &rommap));
+  ASSERT_RAISES(IOError, rommap->Resize(10));
+}
+
+#if defined(__linux__)
+TEST_F(TestMemoryMappedFile, GrowFailureKeepsFileSize) {
+  const int64_t page_size = sysconf(_SC_PAGESIZE);
+  std::string path = "ipc-grow-failure-test";
+  std::shared_ptr<MemoryMappedFile> rwmmap;
+  ASSERT_OK(InitMemoryMap(page_size, path, &rwmmap));
+
+  // A live Buffer prevents moving the map, and a mapping right after it
+  // prevents growing it in place. The hint is only not taken when the page
+  // after the map is already in use
+  std::shared_ptr<Buffer> out_buffer;
+  ASSERT_OK(rwmmap->ReadAt(0, 10, &out_buffer));
+  uint8_t* next_page = const_cast<uint8_t*>(out_buffer->data()) + page_size;
+  void* blocker = mmap(next_page, static_cast<size_t>(page_size), PROT_NONE,
+      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  ASSERT_NE(MAP_FAILED, blocker);
+
+  ASSERT_RAISES(IOError, rwmmap->Resize(page_size * 4));
+  ASSERT_OK(rwmmap->Seek(page_size));
+  ASSERT_RAISES(IOError, rwmmap->Write(out_buffer->data(), 10));
+
+  std::shared_ptr<ReadableFile> file;
+  int64_t size;
+  ASSERT_OK(ReadableFile::Open(path, &file));
+  ASSERT_OK(file->GetSize(&size));
+  ASSERT_EQ(page_size, size);
+
+  munmap(blocker, static_cast<size_t>(page_size));
+  out_buffer.reset();
+  ASSERT_OK(rwmmap->Resize(page_size * 4));
+  ASSERT_OK(rwmmap->GetSize(&size));
+  ASSERT_EQ(page_size * 4, size);
+}
+#endif
+
+TEST_F(TestMemoryMappedFile, MapRegion) {
+  const int64_t buffer_size = 100000;
+  std::vector<uint8_t> buffer(buffer_size);
+  test::random_bytes(buffer_size, 0, buffer.data());
+
+  std::string path = "ipc-map-region-test";
+  std::shared_ptr<MemoryMappedFile> rwmmap;
+  ASSERT_OK(InitMemoryMap(buffer_size, path, &rwmmap));
+  ASSERT_OK(rwmmap->Write(buffer.data(), buffer_size));
+  ASSERT_OK(rwmmap->Close());
+
+  // Not aligned to a page
+  const int64_t offset = 12345;
+  const int64_t length = 50000;
+  std::shared_ptr<MemoryMappedFile> region;
+  ASSERT_OK(MemoryMappedFile::Open(path, FileMode::READ, offset, length, &region));
+
+  int64_t size;
+  ASSERT_OK(region->GetSize(&size));
+  ASSERT_EQ(length, size);
+
+  std::shared_ptr<Buffer> out_buffer;
+  ASSERT_OK(region->Read(length + 100, &out_buffer));
+  ASSERT_EQ(length, out_buffer->size());
+  ASSERT_EQ(0, memcmp(out_buffer->data(), buffer.data() + offset, length));
+
+  // To the end of the file
+  ASSERT_OK(MemoryMappedFile::Open(path, FileMode::READWRITE, offset, -1, &region));
+  ASSERT_OK(region->GetSize(&size));
+  ASSERT_EQ(buffer_size - offset, size);
+
+  ASSERT_OK(region->WriteAt(0, buffer.data(), 10));
+  ASSERT_RAISES(Invalid, region->WriteAt(size - 5, buffer.data(), 10));
+  ASSERT_RAISES(Invalid, region->Resize(size + 10));
+
+  ASSERT_RAISES(Invalid,
+      MemoryMappedFile::Open(path, FileMode::READ, buffer_size + 1, -1, &region));
+  ASSERT_RAISES(
+      Invalid, MemoryMappedFile::Open(path, FileMode::READ, 10, buffer_size, &region));
+}
+
+TEST_F(TestMemoryMappedFile, Advise) {
+  const int64_t buffer_size = 100000;
+  std::string path = "ipc-advise-test";
+  std::shared_ptr<MemoryMappedFile> rwmmap;
+  ASSERT_OK(InitMemoryMap(buffer_size, path, &rwmmap));
+  ASSERT_OK(ZeroMemoryMap(rwmmap.get()));
+  ASSERT_OK(rwmmap->Close());
+
+  std::shared_ptr<MemoryMappedFile> rommap;
+  ASSERT_OK(MemoryMappedFile::Open(path, FileMode::READ, &rommap));
+  ASSERT_OK(rommap->Advise(MemoryAdvice::SEQUENTIAL));
+  ASSERT_OK(rommap->Advise(MemoryAdvice::WILLNEED, 5000, 20000));
+  ASSERT_OK(rommap->Advise(MemoryAdvice::RANDOM, 99999, 100));
+  ASSERT_OK(rommap->Advise(MemoryAdvice::NORMAL, buffer_size + 1, 100));
+  ASSERT_RAISES(Invalid, rommap->Advise(MemoryAdvice::WILLNEED, -1, 100));
+
+  std::shared_ptr<Buffer> out_buffer;
+  ASSERT_OK(rommap->ReadAt(buffer_size - 10, 10, &out_buffer));
+  ASSERT_EQ(0, out_buffer->data()[9]);
+}
+
 TEST_F(TestMemoryMappedFile, RetainMemoryMapReference) {
   // ARROW-494
 
@@ -587,5 +1001,37 @@ TEST_F(TestMemoryMappedFile, ThreadSafety) {
   ASSERT_EQ(niter * 2, correct_count);
 }
 
+TEST_F(TestMemoryMappedFile, ReadWhileGrowing) {
+  std::string data = "foobar";
+  std::string path = "ipc-read-while-growing-test";
+  std::shared_ptr<MemoryMappedFile> file;
+  ASSERT_OK(InitMemoryMap(0, path, &file));
+  ASSERT_OK(file->Write(
+      reinterpret_cast<const uint8_t*>(data.c_str()), static_cast<int64_t>(data.size())));
+
+  // Raw reads hold no Buffer, so the growing writes are free to move the map
+  std::atomic<bool> done(false);
+  std::atomic<int> correct_count(0);
+  auto ReadData = [&]() {
+    uint8_t out[6];
+    int64_t bytes_read = 0;
+    while (!done) {
+      ASSERT_OK(file->ReadAt(0, 6, &bytes_read, out));
+      if (0 == memcmp(data.c_str(), out, 6)) { correct_count += 1; }
+    }
+  };
+  std::thread reader(ReadData);
+
+  std::vector<uint8_t> chunk(1 << 16, 1);
+  for (int i = 0; i < 200; ++i) {
+    ASSERT_OK(file->Write(chunk.data(), static_cast<int64_t>(chunk.size())));
+  }
+  done = true;
+  reader.join();
+
+  ASSERT_GT(correct_count, 0);
+  ASSERT_OK(file->Close());
+}
+
 }  // namespace io
 }  // namespace arrow
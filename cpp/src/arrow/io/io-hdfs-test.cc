@@ -371,6 +371,37 @@ TYPED_TEST(TestHdfsClient, LargeFile) {
   ASSERT_EQ(size, bytes_read);
 }
 
+TYPED_TEST(TestHdfsClient, Writev) {
+  SKIP_IF_NO_DRIVER();
+
+  ASSERT_OK(this->MakeScratchDir());
+
+  auto path = this->ScratchPath("test-writev");
+  const int size = 200000;
+  std::vector<uint8_t> data = RandomData(size);
+
+  // Small buffers packed together around one written directly
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  buffers.push_back(std::make_shared<Buffer>(data.data(), 1000));
+  buffers.push_back(std::make_shared<Buffer>(data.data() + 1000, 9000));
+  buffers.push_back(std::make_shared<Buffer>(data.data() + 10000, 150000));
+  buffers.push_back(std::make_shared<Buffer>(data.data() + 160000, 40000));
+
+  std::shared_ptr<HdfsOutputStream> out_file;
+  ASSERT_OK(this->client_->OpenWriteable(path, false, &out_file));
+  ASSERT_OK(out_file->Writev(buffers));
+  ASSERT_OK(out_file->Close());
+
+  std::shared_ptr<HdfsReadableFile> file;
+  ASSERT_OK(this->client_->OpenReadable(path, &file));
+
+  std::vector<uint8_t> out(size);
+  int64_t bytes_read = 0;
+  ASSERT_OK(file->Read(size, &bytes_read, out.data()));
+  ASSERT_EQ(size, bytes_read);
+  ASSERT_EQ(0, std::memcmp(out.data(), data.data(), size));
+}
+
 TYPED_TEST(TestHdfsClient, RenameFile) {
   SKIP_IF_NO_DRIVER();
   ASSERT_OK(this->MakeScratchDir());
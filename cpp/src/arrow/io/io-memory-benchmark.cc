@@ -22,6 +22,8 @@
 #include "benchmark/benchmark.h"
 
 #include <iostream>
+#include <memory>
+#include <vector>
 
 namespace arrow {
 
@@ -60,6 +62,45 @@ static void BM_ParallelMemcopy(benchmark::State& state) {  // NOLINT non-const r
   state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
 }
 
+// Each iteration serializes 256MB in 1MB writes into a growing stream
+static constexpr int64_t kStreamTotalSize = 256 * 1024 * 1024;
+static constexpr int64_t kStreamWriteSize = 1024 * 1024;
+
+static void BM_BufferOutputStreamGrowth(
+    benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<uint8_t> data(kStreamWriteSize);
+  test::random_bytes(kStreamWriteSize, 0, data.data());
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<io::BufferOutputStream> stream;
+    ABORT_NOT_OK(io::BufferOutputStream::Create(0, default_memory_pool(), &stream));
+    for (int64_t i = 0; i < kStreamTotalSize; i += kStreamWriteSize) {
+      ABORT_NOT_OK(stream->Write(data.data(), kStreamWriteSize));
+    }
+    std::shared_ptr<Buffer> result;
+    ABORT_NOT_OK(stream->Finish(&result));
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * kStreamTotalSize);
+}
+
+static void BM_ChunkedBufferOutputStreamGrowth(
+    benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<uint8_t> data(kStreamWriteSize);
+  test::random_bytes(kStreamWriteSize, 0, data.data());
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<io::ChunkedBufferOutputStream> stream;
+    ABORT_NOT_OK(io::ChunkedBufferOutputStream::Create(
+        state.range(0), default_memory_pool(), &stream));
+    for (int64_t i = 0; i < kStreamTotalSize; i += kStreamWriteSize) {
+      ABORT_NOT_OK(stream->Write(data.data(), kStreamWriteSize));
+    }
+    std::vector<std::shared_ptr<Buffer>> result;
+    ABORT_NOT_OK(stream->Finish(&result));
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * kStreamTotalSize);
+}
+
 BENCHMARK(BM_SerialMemcopy)
     ->RangeMultiplier(4)
     ->Range(1, 1 << 13)
@@ -72,4 +113,11 @@ BENCHMARK(BM_ParallelMemcopy)
     ->MinTime(1.0)
     ->UseRealTime();
 
+BENCHMARK(BM_BufferOutputStreamGrowth)->UseRealTime();
+
+BENCHMARK(BM_ChunkedBufferOutputStreamGrowth)
+    ->RangeMultiplier(16)
+    ->Range(1 << 16, 1 << 24)
+    ->UseRealTime();
+
 }  // namespace arrow
@@ -115,6 +115,147 @@ TEST(TestBufferReader, RetainParentReference) {
   ASSERT_EQ(0, std::memcmp(slice2->data(), data.c_str() + 4, 6));
 }
 
+TEST_F(TestBufferOutputStream, Writev) {
+  std::string data1 = "data123456";
+  std::string data2(1000, 'x');
+  auto AsBuffer = [](const std::string& s) {
+    return std::make_shared<Buffer>(
+        reinterpret_cast<const uint8_t*>(s.c_str()), static_cast<int64_t>(s.size()));
+  };
+  std::vector<std::shared_ptr<Buffer>> buffers = {
+      AsBuffer(data1), std::make_shared<Buffer>(nullptr, 0), AsBuffer(data2)};
+
+  ASSERT_OK(stream_->Writev(buffers));
+  ASSERT_OK(stream_->Writev(buffers));
+
+  int64_t position;
+  ASSERT_OK(stream_->Tell(&position));
+  ASSERT_EQ(2020, position);
+
+  ASSERT_OK(stream_->Close());
+  std::string expected = data1 + data2 + data1 + data2;
+  ASSERT_EQ(0, std::memcmp(buffer_->data(), expected.c_str(), expected.size()));
+}
+
+TEST(TestChunkedBufferOutputStream, Basics) {
+  std::shared_ptr<ChunkedBufferOutputStream> stream;
+  ASSERT_OK(ChunkedBufferOutputStream::Create(100, default_memory_pool(), &stream));
+
+  std::vector<uint8_t> data(1000);
+  test::random_bytes(data.size(), 0, data.data());
+
+  // Writes that fit in a chunk, straddle chunks, and span several
+  int64_t offset = 0;
+  for (int64_t nbytes : {10, 95, 0, 350, 55}) {
+    ASSERT_OK(stream->Write(data.data() + offset, nbytes));
+    offset += nbytes;
+
+    int64_t position;
+    ASSERT_OK(stream->Tell(&position));
+    ASSERT_EQ(offset, position);
+  }
+
+  // Full chunks, then the remainder
+  std::vector<std::shared_ptr<Buffer>> chunks;
+  ASSERT_OK(stream->Finish(&chunks));
+  ASSERT_EQ(6, static_cast<int>(chunks.size()));
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    const int64_t expected_size = i < 5 ? 100 : 10;
+    ASSERT_EQ(expected_size, chunks[i]->size());
+    ASSERT_EQ(0, std::memcmp(chunks[i]->data(), data.data() + i * 100, expected_size));
+  }
+
+  ASSERT_RAISES(
+      Invalid, ChunkedBufferOutputStream::Create(0, default_memory_pool(), &stream));
+}
+
+TEST(TestBufferReader, ReadRanges) {
+  std::string data = "0123456789abcdefghijklmnopqrstuvwxyz";
+  BufferReader reader(reinterpret_cast<const uint8_t*>(data.c_str()), data.size());
+
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  ASSERT_OK(reader.ReadRanges({{30, 3}, {2, 4}, {0, 0}, {3, 5}, {34, 10}}, &buffers));
+  ASSERT_EQ(5, static_cast<int>(buffers.size()));
+
+  auto AssertBufferEquals = [&data](const Buffer& buffer, int64_t offset,
+      int64_t length) {
+    ASSERT_EQ(length, buffer.size());
+    ASSERT_EQ(0, std::memcmp(buffer.data(), data.c_str() + offset, length));
+  };
+  AssertBufferEquals(*buffers[0], 30, 3);
+  AssertBufferEquals(*buffers[1], 2, 4);
+  AssertBufferEquals(*buffers[2], 0, 0);
+  AssertBufferEquals(*buffers[3], 3, 5);
+
+  // Truncated at the end of the data
+  AssertBufferEquals(*buffers[4], 34, 2);
+}
+
+TEST(TestBufferReader, ReadAtDoesNotMoveCursor) {
+  std::string data = "0123456789";
+  BufferReader reader(reinterpret_cast<const uint8_t*>(data.c_str()), data.size());
+
+  ASSERT_OK(reader.Seek(2));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(reader.ReadAt(6, 3, &buffer));
+  ASSERT_EQ(0, std::memcmp(buffer->data(), "678", 3));
+
+  uint8_t out[3];
+  int64_t bytes_read = 0;
+  ASSERT_OK(reader.ReadAt(7, 3, &bytes_read, out));
+  ASSERT_EQ(0, std::memcmp(out, "789", 3));
+
+  int64_t position = 0;
+  ASSERT_OK(reader.Tell(&position));
+  ASSERT_EQ(2, position);
+  ASSERT_OK(reader.Read(2, &buffer));
+  ASSERT_EQ(0, std::memcmp(buffer->data(), "23", 2));
+}
+
+TEST(TestBufferReader, Advance) {
+  std::string data = "0123456789";
+  BufferReader reader(reinterpret_cast<const uint8_t*>(data.c_str()), data.size());
+
+  ASSERT_OK(reader.Advance(4));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(reader.Read(2, &buffer));
+  ASSERT_EQ(0, std::memcmp(buffer->data(), "45", 2));
+
+  // Up to the end, then past it
+  ASSERT_OK(reader.Advance(4));
+  ASSERT_OK(reader.Read(2, &buffer));
+  ASSERT_EQ(0, buffer->size());
+  ASSERT_RAISES(IOError, reader.Advance(1));
+}
+
+TEST(TestCoalesceReadRanges, Basics) {
+  auto AssertCoalesced = [](std::vector<ReadRange> ranges, int64_t hole_size_limit,
+      int64_t range_size_limit, std::vector<ReadRange> expected) {
+    std::vector<ReadRange> result =
+        CoalesceReadRanges(ranges, hole_size_limit, range_size_limit);
+    ASSERT_EQ(expected.size(), result.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      ASSERT_EQ(expected[i].offset, result[i].offset);
+      ASSERT_EQ(expected[i].length, result[i].length);
+    }
+  };
+
+  AssertCoalesced({}, 10, 100, {});
+
+  // Sorted, and empty ranges dropped
+  AssertCoalesced({{50, 10}, {0, 10}, {20, 0}}, 0, 100, {{0, 10}, {50, 10}});
+
+  // Adjacent and overlapping ranges merge even without holes
+  AssertCoalesced({{0, 10}, {10, 10}, {15, 2}, {18, 10}}, 0, 100, {{0, 28}});
+
+  // Gaps up to the hole size limit merge
+  AssertCoalesced({{0, 10}, {15, 5}, {30, 5}}, 5, 100, {{0, 20}, {30, 5}});
+  AssertCoalesced({{0, 10}, {15, 5}, {30, 5}}, 10, 100, {{0, 35}});
+
+  // Merged ranges do not exceed the range size limit
+  AssertCoalesced({{0, 10}, {15, 5}, {30, 5}}, 10, 20, {{0, 20}, {30, 5}});
+}
+
 TEST(TestMemcopy, ParallelMemcopy) {
   for (int i = 0; i < 5; ++i) {
     // randomize size so the memcopy alignment is tested
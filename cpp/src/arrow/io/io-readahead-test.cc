@@ -0,0 +1,194 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "arrow/io/memory.h"
+#include "arrow/io/readahead.h"
+#include "arrow/io/test-common.h"
+
+namespace arrow {
+namespace io {
+
+// Counts reads of the wrapped stream and fails once max_reads is exceeded
+class LimitedInputStream : public InputStream {
+ public:
+  LimitedInputStream(const std::shared_ptr<InputStream>& raw, int max_reads)
+      : raw_(raw), num_reads_(0), max_reads_(max_reads) {}
+
+  Status Close() override { return raw_->Close(); }
+  Status Tell(int64_t* position) override { return raw_->Tell(position); }
+  Status Read(int64_t nbytes, int64_t* bytes_read, uint8_t* out) override {
+    if (++num_reads_ > max_reads_) { return Status::IOError("Too many reads"); }
+    return raw_->Read(nbytes, bytes_read, out);
+  }
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    if (++num_reads_ > max_reads_) { return Status::IOError("Too many reads"); }
+    return raw_->Read(nbytes, out);
+  }
+
+  int num_reads() const { return num_reads_; }
+
+ private:
+  std::shared_ptr<InputStream> raw_;
+  std::atomic<int> num_reads_;
+  int max_reads_;
+};
+
+class TestReadaheadInputStream : public ::testing::Test {
+ public:
+  void SetUp() {
+    data_.resize(10000);
+    test::random_bytes(data_.size(), 0, data_.data());
+  }
+
+  void MakeStream(int64_t read_size, int32_t num_reads, int max_reads = 1 << 30) {
+    auto reader = std::make_shared<BufferReader>(data_.data(), data_.size());
+    raw_ = std::make_shared<LimitedInputStream>(reader, max_reads);
+    ASSERT_OK(ReadaheadInputStream::Open(
+        raw_, read_size, num_reads, default_memory_pool(), &stream_));
+  }
+
+ protected:
+  std::vector<uint8_t> data_;
+  std::shared_ptr<LimitedInputStream> raw_;
+  std::shared_ptr<ReadaheadInputStream> stream_;
+};
+
+TEST_F(TestReadaheadInputStream, SequentialReads) {
+  MakeStream(1000, 3);
+
+  std::vector<uint8_t> out(data_.size());
+  int64_t offset = 0;
+  int64_t bytes_read;
+  do {
+    // Reads straddle block boundaries
+    ASSERT_OK(stream_->Read(777, &bytes_read, out.data() + offset));
+    offset += bytes_read;
+
+    int64_t position;
+    ASSERT_OK(stream_->Tell(&position));
+    ASSERT_EQ(offset, position);
+  } while (bytes_read > 0);
+
+  ASSERT_EQ(static_cast<int64_t>(data_.size()), offset);
+  ASSERT_EQ(0, std::memcmp(out.data(), data_.data(), data_.size()));
+
+  // 10 blocks plus the read at the end of the stream
+  ASSERT_EQ(11, raw_->num_reads());
+}
+
+TEST_F(TestReadaheadInputStream, ZeroCopyReads) {
+  MakeStream(1000, 2);
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(stream_->Read(100, &buffer));
+  ASSERT_EQ(100, buffer->size());
+  ASSERT_EQ(data_.data(), buffer->data());
+
+  // Remainder of the first block
+  ASSERT_OK(stream_->ReadNextBuffer(&buffer));
+  ASSERT_EQ(900, buffer->size());
+  ASSERT_EQ(data_.data() + 100, buffer->data());
+
+  ASSERT_OK(stream_->ReadNextBuffer(&buffer));
+  ASSERT_EQ(1000, buffer->size());
+  ASSERT_EQ(data_.data() + 1000, buffer->data());
+
+  // Spans blocks, so it is a copy
+  ASSERT_OK(stream_->Read(1500, &buffer));
+  ASSERT_EQ(1500, buffer->size());
+  ASSERT_EQ(0, std::memcmp(buffer->data(), data_.data() + 2000, 1500));
+
+  ASSERT_OK(stream_->Read(10000, &buffer));
+  ASSERT_EQ(6500, buffer->size());
+  ASSERT_EQ(0, std::memcmp(buffer->data(), data_.data() + 3500, 6500));
+
+  int64_t position;
+  ASSERT_OK(stream_->Tell(&position));
+  ASSERT_EQ(10000, position);
+
+  ASSERT_OK(stream_->ReadNextBuffer(&buffer));
+  ASSERT_EQ(0, buffer->size());
+}
+
+TEST_F(TestReadaheadInputStream, BoundedReadahead) {
+  MakeStream(100, 4);
+
+  // Give the background thread time to run ahead as far as it may
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  ASSERT_LE(raw_->num_reads(), 4);
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(stream_->ReadNextBuffer(&buffer));
+  ASSERT_EQ(0, std::memcmp(buffer->data(), data_.data(), 100));
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  ASSERT_LE(raw_->num_reads(), 5);
+
+  // Stops the background thread with blocks still queued
+  ASSERT_OK(stream_->Close());
+  ASSERT_RAISES(IOError, stream_->ReadNextBuffer(&buffer));
+}
+
+TEST_F(TestReadaheadInputStream, ErrorAfterData) {
+  MakeStream(1000, 2, 3);
+
+  std::vector<uint8_t> out(data_.size());
+  int64_t bytes_read;
+  ASSERT_OK(stream_->Read(3000, &bytes_read, out.data()));
+  ASSERT_EQ(3000, bytes_read);
+  ASSERT_EQ(0, std::memcmp(out.data(), data_.data(), 3000));
+
+  ASSERT_RAISES(IOError, stream_->Read(1, &bytes_read, out.data()));
+}
+
+TEST_F(TestReadaheadInputStream, Advance) {
+  MakeStream(1000, 2);
+
+  // Skips by reading through the blocks
+  ASSERT_OK(stream_->Advance(2500));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(stream_->Read(100, &buffer));
+  ASSERT_EQ(0, std::memcmp(buffer->data(), data_.data() + 2500, 100));
+
+  int64_t position;
+  ASSERT_OK(stream_->Tell(&position));
+  ASSERT_EQ(2600, position);
+
+  ASSERT_RAISES(IOError, stream_->Advance(10000));
+}
+
+TEST_F(TestReadaheadInputStream, InvalidArguments) {
+  auto reader = std::make_shared<BufferReader>(data_.data(), data_.size());
+  ASSERT_RAISES(Invalid,
+      ReadaheadInputStream::Open(reader, 0, 1, default_memory_pool(), &stream_));
+  ASSERT_RAISES(Invalid,
+      ReadaheadInputStream::Open(reader, 1, 0, default_memory_pool(), &stream_));
+}
+
+}  // namespace io
+}  // namespace arrow
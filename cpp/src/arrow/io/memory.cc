@@ -24,6 +24,8 @@
 #include <cstring>
 #include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/io/interfaces.h"
@@ -86,6 +88,20 @@ Status BufferOutputStream::Write(const uint8_t* data, int64_t nbytes) {
   return Status::OK();
 }
 
+Status BufferOutputStream::Writev(const std::vector<std::shared_ptr<Buffer>>& buffers) {
+  DCHECK(buffer_);
+  int64_t total = 0;
+  for (const auto& buffer : buffers) {
+    total += buffer->size();
+  }
+  RETURN_NOT_OK(Reserve(total));
+  for (const auto& buffer : buffers) {
+    memcpy(mutable_data_ + position_, buffer->data(), buffer->size());
+    position_ += buffer->size();
+  }
+  return Status::OK();
+}
+
 Status BufferOutputStream::Reserve(int64_t nbytes) {
   int64_t new_capacity = capacity_;
   while (position_ + nbytes > new_capacity) {
@@ -99,6 +115,67 @@ Status BufferOutputStream::Reserve(int64_t nbytes) {
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// OutputStream that writes to a list of chunks
+
+ChunkedBufferOutputStream::ChunkedBufferOutputStream(int64_t chunk_size, MemoryPool* pool)
+    : chunk_size_(chunk_size), pool_(pool), current_position_(0), position_(0) {}
+
+Status ChunkedBufferOutputStream::Create(int64_t chunk_size, MemoryPool* pool,
+    std::shared_ptr<ChunkedBufferOutputStream>* out) {
+  if (chunk_size <= 0) { return Status::Invalid("Chunk size must be positive"); }
+  *out = std::shared_ptr<ChunkedBufferOutputStream>(
+      new ChunkedBufferOutputStream(chunk_size, pool));
+  return Status::OK();
+}
+
+ChunkedBufferOutputStream::~ChunkedBufferOutputStream() {}
+
+Status ChunkedBufferOutputStream::Close() {
+  if (current_) {
+    // Trim the last chunk to the bytes written. PoolBuffer only reallocates
+    // once at least half of the chunk is unused, so it may keep some slack.
+    RETURN_NOT_OK(current_->Resize(current_position_));
+    chunks_.push_back(current_);
+    current_.reset();
+  }
+  return Status::OK();
+}
+
+Status ChunkedBufferOutputStream::Finish(std::vector<std::shared_ptr<Buffer>>* result) {
+  RETURN_NOT_OK(Close());
+  *result = std::move(chunks_);
+  chunks_.clear();
+  position_ = 0;
+  return Status::OK();
+}
+
+Status ChunkedBufferOutputStream::Tell(int64_t* position) {
+  *position = position_;
+  return Status::OK();
+}
+
+Status ChunkedBufferOutputStream::Write(const uint8_t* data, int64_t nbytes) {
+  while (nbytes > 0) {
+    if (!current_ || current_position_ == chunk_size_) { RETURN_NOT_OK(NextChunk()); }
+    const int64_t ncopy = std::min(nbytes, chunk_size_ - current_position_);
+    memcpy(current_->mutable_data() + current_position_, data,
+        static_cast<size_t>(ncopy));
+    current_position_ += ncopy;
+    position_ += ncopy;
+    data += ncopy;
+    nbytes -= ncopy;
+  }
+  return Status::OK();
+}
+
+Status ChunkedBufferOutputStream::NextChunk() {
+  if (current_) { chunks_.push_back(current_); }
+  RETURN_NOT_OK(AllocateResizableBuffer(pool_, chunk_size_, &current_));
+  current_position_ = 0;
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // In-memory buffer writer
 
@@ -219,7 +296,8 @@ Status BufferReader::GetSize(int64_t* size) {
 }
 
 Status BufferReader::Seek(int64_t position) {
-  if (position < 0 || position >= size_) {
+  // Seeking to the end is allowed, so that all of the buffer can be skipped
+  if (position < 0 || position > size_) {
     return Status::IOError("position out of bounds");
   }
 
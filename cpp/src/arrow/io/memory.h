@@ -24,6 +24,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #include "arrow/io/interfaces.h"
 
@@ -54,6 +55,9 @@ class ARROW_EXPORT BufferOutputStream : public OutputStream {
   Status Tell(int64_t* position) override;
   Status Write(const uint8_t* data, int64_t nbytes) override;
 
+  /// Copy the buffers in, growing the buffer at most once
+  Status Writev(const std::vector<std::shared_ptr<Buffer>>& buffers) override;
+
   /// Close the stream and return the buffer
   Status Finish(std::shared_ptr<Buffer>* result);
 
@@ -67,6 +71,44 @@ class ARROW_EXPORT BufferOutputStream : public OutputStream {
   uint8_t* mutable_data_;
 };
 
+/// \brief An output stream that writes into a list of fixed-size chunks
+/// allocated from a memory pool as needed.
+///
+/// Unlike BufferOutputStream, data is never copied again as the stream grows,
+/// and at most one chunk is allocated beyond the data written
+class ARROW_EXPORT ChunkedBufferOutputStream : public OutputStream {
+ public:
+  static Status Create(int64_t chunk_size, MemoryPool* pool,
+      std::shared_ptr<ChunkedBufferOutputStream>* out);
+
+  ~ChunkedBufferOutputStream();
+
+  // Implement the OutputStream interface
+  Status Close() override;
+  Status Tell(int64_t* position) override;
+  Status Write(const uint8_t* data, int64_t nbytes) override;
+
+  /// Close the stream and return the chunks written, in order. All but the
+  /// last are chunk_size bytes long
+  Status Finish(std::vector<std::shared_ptr<Buffer>>* result);
+
+  int64_t chunk_size() const { return chunk_size_; }
+
+ private:
+  ChunkedBufferOutputStream(int64_t chunk_size, MemoryPool* pool);
+
+  Status NextChunk();
+
+  int64_t chunk_size_;
+  MemoryPool* pool_;
+  std::vector<std::shared_ptr<Buffer>> chunks_;
+
+  // The chunk being written to
+  std::shared_ptr<ResizableBuffer> current_;
+  int64_t current_position_;
+  int64_t position_;
+};
+
 /// \brief Enables random writes into a fixed-size mutable buffer
 ///
 class ARROW_EXPORT FixedSizeBufferWriter : public WriteableFile {
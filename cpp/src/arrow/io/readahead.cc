@@ -0,0 +1,260 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/readahead.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+
+namespace arrow {
+namespace io {
+
+// ----------------------------------------------------------------------
+// ReadaheadInputStream implementation
+
+// The background thread fills queue_ with blocks read from raw_; the consumer
+// takes blocks from the front into current_ and reads from it
+class ReadaheadInputStream::ReadaheadInputStreamImpl {
+ public:
+  ReadaheadInputStreamImpl(const std::shared_ptr<InputStream>& raw, int64_t read_size,
+      int32_t num_reads, MemoryPool* pool)
+      : raw_(raw),
+        read_size_(read_size),
+        num_reads_(num_reads),
+        pool_(pool),
+        current_pos_(0),
+        position_(0),
+        stop_(false),
+        done_(false) {}
+
+  ~ReadaheadInputStreamImpl() { Stop(); }
+
+  Status Start() {
+    RETURN_NOT_OK(raw_->Tell(&position_));
+    worker_ = std::thread([this]() { WorkerLoop(); });
+    return Status::OK();
+  }
+
+  void Stop() {
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      stop_ = true;
+    }
+    space_available_.notify_one();
+    if (worker_.joinable()) { worker_.join(); }
+  }
+
+  Status Close() {
+    Stop();
+    current_.reset();
+    queue_.clear();
+    return raw_->Close();
+  }
+
+  int64_t position() const { return position_; }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, uint8_t* out) {
+    *bytes_read = 0;
+    while (*bytes_read < nbytes) {
+      bool eof;
+      RETURN_NOT_OK(FetchBlock(&eof));
+      if (eof) { break; }
+      const int64_t ncopy = std::min(nbytes - *bytes_read, current_remaining());
+      std::memcpy(out + *bytes_read, current_->data() + current_pos_,
+          static_cast<size_t>(ncopy));
+      Advance(ncopy);
+      *bytes_read += ncopy;
+    }
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    bool eof;
+    RETURN_NOT_OK(FetchBlock(&eof));
+    if (eof) {
+      *out = std::make_shared<Buffer>(nullptr, 0);
+      return Status::OK();
+    }
+    if (nbytes <= current_remaining()) {
+      *out = SliceBuffer(current_, current_pos_, nbytes);
+      Advance(nbytes);
+      return Status::OK();
+    }
+
+    // Spans several blocks, so must be copied
+    std::shared_ptr<ResizableBuffer> buffer;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buffer));
+    int64_t bytes_read = 0;
+    RETURN_NOT_OK(Read(nbytes, &bytes_read, buffer->mutable_data()));
+    if (bytes_read < nbytes) { RETURN_NOT_OK(buffer->Resize(bytes_read)); }
+    *out = buffer;
+    return Status::OK();
+  }
+
+  Status ReadNextBuffer(std::shared_ptr<Buffer>* out) {
+    bool eof;
+    RETURN_NOT_OK(FetchBlock(&eof));
+    if (eof) {
+      *out = std::make_shared<Buffer>(nullptr, 0);
+      return Status::OK();
+    }
+    const int64_t nbytes = current_remaining();
+    *out = current_pos_ == 0 ? current_ : SliceBuffer(current_, current_pos_, nbytes);
+    Advance(nbytes);
+    return Status::OK();
+  }
+
+  std::shared_ptr<InputStream> raw() const { return raw_; }
+
+ private:
+  int64_t current_remaining() const {
+    return current_ ? current_->size() - current_pos_ : 0;
+  }
+
+  void Advance(int64_t nbytes) {
+    current_pos_ += nbytes;
+    position_ += nbytes;
+  }
+
+  // Make sure current_ has unread bytes, waiting for the background thread if
+  // needed. Errors from the background reads are returned once the blocks read
+  // before them have been consumed
+  Status FetchBlock(bool* eof) {
+    *eof = false;
+    if (current_remaining() > 0) { return Status::OK(); }
+
+    std::unique_lock<std::mutex> lock(lock_);
+    data_available_.wait(lock, [this]() { return !queue_.empty() || done_ || stop_; });
+    if (stop_) { return Status::IOError("Stream is closed"); }
+    if (queue_.empty()) {
+      *eof = true;
+      current_.reset();
+      return status_;
+    }
+    current_ = queue_.front();
+    current_pos_ = 0;
+    queue_.pop_front();
+    lock.unlock();
+
+    space_available_.notify_one();
+    return Status::OK();
+  }
+
+  void WorkerLoop() {
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(lock_);
+        space_available_.wait(lock, [this]() {
+          return stop_ || static_cast<int32_t>(queue_.size()) < num_reads_;
+        });
+        if (stop_) { return; }
+      }
+
+      std::shared_ptr<Buffer> buffer;
+      Status st = raw_->Read(read_size_, &buffer);
+
+      bool done = !st.ok() || buffer->size() == 0;
+      {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (done) {
+          status_ = st;
+          done_ = true;
+        } else {
+          queue_.push_back(buffer);
+        }
+      }
+      data_available_.notify_one();
+      if (done) { return; }
+    }
+  }
+
+  std::shared_ptr<InputStream> raw_;
+  int64_t read_size_;
+  int32_t num_reads_;
+  MemoryPool* pool_;
+
+  // Only touched by the consumer
+  std::shared_ptr<Buffer> current_;
+  int64_t current_pos_;
+  int64_t position_;
+
+  // Shared with the background thread, guarded by lock_
+  std::mutex lock_;
+  std::condition_variable data_available_;
+  std::condition_variable space_available_;
+  std::deque<std::shared_ptr<Buffer>> queue_;
+  Status status_;
+  bool stop_;
+  bool done_;
+
+  std::thread worker_;
+};
+
+ReadaheadInputStream::ReadaheadInputStream() {}
+
+ReadaheadInputStream::~ReadaheadInputStream() {}
+
+Status ReadaheadInputStream::Open(const std::shared_ptr<InputStream>& raw,
+    int64_t read_size, int32_t num_reads, MemoryPool* pool,
+    std::shared_ptr<ReadaheadInputStream>* out) {
+  if (read_size <= 0) { return Status::Invalid("Read size must be positive"); }
+  if (num_reads <= 0) { return Status::Invalid("Number of reads must be positive"); }
+
+  std::shared_ptr<ReadaheadInputStream> result(new ReadaheadInputStream());
+  result->impl_.reset(new ReadaheadInputStreamImpl(raw, read_size, num_reads, pool));
+  RETURN_NOT_OK(result->impl_->Start());
+  *out = result;
+  return Status::OK();
+}
+
+Status ReadaheadInputStream::Close() {
+  return impl_->Close();
+}
+
+Status ReadaheadInputStream::Tell(int64_t* position) {
+  *position = impl_->position();
+  return Status::OK();
+}
+
+Status ReadaheadInputStream::Read(int64_t nbytes, int64_t* bytes_read, uint8_t* out) {
+  return impl_->Read(nbytes, bytes_read, out);
+}
+
+Status ReadaheadInputStream::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  return impl_->Read(nbytes, out);
+}
+
+Status ReadaheadInputStream::ReadNextBuffer(std::shared_ptr<Buffer>* out) {
+  return impl_->ReadNextBuffer(out);
+}
+
+std::shared_ptr<InputStream> ReadaheadInputStream::raw() const {
+  return impl_->raw();
+}
+
+}  // namespace io
+}  // namespace arrow
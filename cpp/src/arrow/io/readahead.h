@@ -0,0 +1,82 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Asynchronous read-ahead for sequential scans of an InputStream
+
+#ifndef ARROW_IO_READAHEAD_H
+#define ARROW_IO_READAHEAD_H
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class Status;
+
+namespace io {
+
+/// \brief An InputStream that reads ahead of the consumer on a background
+/// thread, keeping up to num_reads blocks of read_size bytes filled so that
+/// decoding the current data overlaps with reading the next.
+///
+/// Reads that fall within one prefetched block are zero-copy slices of it.
+/// Reads from the wrapped stream must not be interleaved with reads from this
+/// stream. Not thread-safe
+class ARROW_EXPORT ReadaheadInputStream : public InputStream {
+ public:
+  /// Stops the background thread, without closing the wrapped stream
+  ~ReadaheadInputStream();
+
+  /// \param[in] raw the stream to read from
+  /// \param[in] read_size the number of bytes requested by each background read
+  /// \param[in] num_reads the maximum number of blocks read ahead
+  /// \param[in] pool the memory pool for Buffers that span several blocks
+  /// \param[out] out the read-ahead stream, already reading
+  static Status Open(const std::shared_ptr<InputStream>& raw, int64_t read_size,
+      int32_t num_reads, MemoryPool* pool, std::shared_ptr<ReadaheadInputStream>* out);
+
+  /// Stop reading ahead and close the wrapped stream
+  Status Close() override;
+  Status Tell(int64_t* position) override;
+
+  /// Read until nbytes have been read or the wrapped stream is exhausted,
+  /// blocking until the background reads catch up
+  Status Read(int64_t nbytes, int64_t* bytes_read, uint8_t* out) override;
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  /// Return the unconsumed remainder of the next prefetched block, which is
+  /// empty at the end of the stream
+  Status ReadNextBuffer(std::shared_ptr<Buffer>* out);
+
+  std::shared_ptr<InputStream> raw() const;
+
+ private:
+  ReadaheadInputStream();
+
+  class ARROW_NO_EXPORT ReadaheadInputStreamImpl;
+  std::unique_ptr<ReadaheadInputStreamImpl> impl_;
+};
+
+}  // namespace io
+}  // namespace arrow
+
+#endif  // ARROW_IO_READAHEAD_H
@@ -19,6 +19,7 @@
 #include <cstdio>
 #include <cstring>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -485,13 +486,14 @@ class TestFileFormat : public ::testing::TestWithParam<MakeRecordBatch*> {
   }
   void TearDown() {}
 
-  Status RoundTripHelper(const BatchVector& in_batches, BatchVector* out_batches) {
+  Status WriteAndOpen(const BatchVector& in_batches,
+      std::shared_ptr<RecordBatchFileReader>* reader,
+      Compression::type compression = Compression::UNCOMPRESSED) {
     // Write the file
     std::shared_ptr<RecordBatchFileWriter> writer;
     RETURN_NOT_OK(
         RecordBatchFileWriter::Open(sink_.get(), in_batches[0]->schema(), &writer));
-
-    const int num_batches = static_cast<int>(in_batches.size());
+    writer->set_compression(compression);
 
     for (const auto& batch : in_batches) {
       RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
@@ -505,8 +507,14 @@ class TestFileFormat : public ::testing::TestWithParam<MakeRecordBatch*> {
 
     // Open the file
     auto buf_reader = std::make_shared<io::BufferReader>(buffer_);
+    return RecordBatchFileReader::Open(buf_reader, footer_offset, reader);
+  }
+
+  Status RoundTripHelper(const BatchVector& in_batches, BatchVector* out_batches) {
+    const int num_batches = static_cast<int>(in_batches.size());
+
     std::shared_ptr<RecordBatchFileReader> reader;
-    RETURN_NOT_OK(RecordBatchFileReader::Open(buf_reader, footer_offset, &reader));
+    RETURN_NOT_OK(WriteAndOpen(in_batches, &reader));
 
     EXPECT_EQ(num_batches, reader->num_record_batches());
     for (int i = 0; i < num_batches; ++i) {
@@ -551,17 +559,22 @@ class TestStreamFormat : public ::testing::TestWithParam<MakeRecordBatch*> {
   }
   void TearDown() {}
 
-  Status RoundTripHelper(
-      const RecordBatch& batch, std::vector<std::shared_ptr<RecordBatch>>* out_batches) {
-    // Write the file
+  Status WriteStream(const RecordBatch& batch, int num_batches,
+      Compression::type compression = Compression::UNCOMPRESSED) {
     std::shared_ptr<RecordBatchStreamWriter> writer;
     RETURN_NOT_OK(RecordBatchStreamWriter::Open(sink_.get(), batch.schema(), &writer));
-    int num_batches = 5;
+    writer->set_compression(compression);
     for (int i = 0; i < num_batches; ++i) {
       RETURN_NOT_OK(writer->WriteRecordBatch(batch));
     }
     RETURN_NOT_OK(writer->Close());
-    RETURN_NOT_OK(sink_->Close());
+    return sink_->Close();
+  }
+
+  Status RoundTripHelper(
+      const RecordBatch& batch, std::vector<std::shared_ptr<RecordBatch>>* out_batches) {
+    // Write the file
+    RETURN_NOT_OK(WriteStream(batch, 5));
 
     // Open the file
     auto buf_reader = std::make_shared<io::BufferReader>(buffer_);
@@ -599,6 +612,174 @@ TEST_P(TestStreamFormat, RoundTrip) {
   }
 }
 
+// The last field, then the first
+static std::vector<int> SomeFieldIndices(const RecordBatch& batch) {
+  if (batch.num_columns() == 1) { return {0}; }
+  return {batch.num_columns() - 1, 0};
+}
+
+static void CheckIncludedFields(const RecordBatch& batch,
+    const std::vector<int>& included_fields, const RecordBatch& result) {
+  ASSERT_EQ(static_cast<int>(included_fields.size()), result.num_columns());
+  ASSERT_EQ(batch.num_rows(), result.num_rows());
+  for (size_t i = 0; i < included_fields.size(); ++i) {
+    const int column = static_cast<int>(i);
+    ASSERT_TRUE(result.schema()->field(column)->Equals(
+        batch.schema()->field(included_fields[i])));
+    CompareArraysDetailed(column, *result.column(column),
+        *batch.column(included_fields[i]));
+  }
+}
+
+TEST_P(TestFileFormat, ReadIncludedFields) {
+  std::shared_ptr<RecordBatch> batch1;
+  std::shared_ptr<RecordBatch> batch2;
+  ASSERT_OK((*GetParam())(&batch1));  // NOLINT clang-tidy gtest issue
+  ASSERT_OK((*GetParam())(&batch2));  // NOLINT clang-tidy gtest issue
+
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(WriteAndOpen({batch1, batch2}, &reader));
+
+  const std::vector<int> included_fields = SomeFieldIndices(*batch1);
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(reader->GetRecordBatch(1, included_fields, &result));
+  CheckIncludedFields(*batch2, included_fields, *result);
+}
+
+TEST_P(TestFileFormat, ReadAll) {
+  BatchVector in_batches(3);
+  for (auto& batch : in_batches) {
+    ASSERT_OK((*GetParam())(&batch));  // NOLINT clang-tidy gtest issue
+  }
+
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(WriteAndOpen(in_batches, &reader));
+
+  std::shared_ptr<Table> expected;
+  ASSERT_OK(Table::FromRecordBatches(in_batches, &expected));
+
+  // More threads than batches splits the batches by field
+  for (int num_threads : {1, 2, 8}) {
+    std::shared_ptr<Table> table;
+    ASSERT_OK(reader->ReadAll(num_threads, &table));
+    ASSERT_TRUE(table->Equals(*expected));
+  }
+}
+
+TEST_P(TestStreamFormat, ReadIncludedFields) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK((*GetParam())(&batch));  // NOLINT clang-tidy gtest issue
+  ASSERT_OK(WriteStream(*batch, 3));
+
+  const std::vector<int> included_fields = SomeFieldIndices(*batch);
+  std::shared_ptr<RecordBatchStreamReader> reader;
+  ASSERT_OK(RecordBatchStreamReader::Open(
+      std::make_shared<io::BufferReader>(buffer_), included_fields, &reader));
+  ASSERT_EQ(static_cast<int>(included_fields.size()), reader->schema()->num_fields());
+
+  int num_batches = 0;
+  std::shared_ptr<RecordBatch> result;
+  while (true) {
+    ASSERT_OK(reader->GetNextRecordBatch(&result));
+    if (result == nullptr) { break; }
+    CheckIncludedFields(*batch, included_fields, *result);
+    ++num_batches;
+  }
+  ASSERT_EQ(3, num_batches);
+}
+
+TEST_P(TestStreamFormat, ReuseBuffers) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK((*GetParam())(&batch));  // NOLINT clang-tidy gtest issue
+  ASSERT_OK(WriteStream(*batch, 3));
+
+  const std::vector<int> included_fields = SomeFieldIndices(*batch);
+  for (bool read_all : {true, false}) {
+    std::shared_ptr<RecordBatchStreamReader> reader;
+    auto source = std::make_shared<io::BufferReader>(buffer_);
+    if (read_all) {
+      ASSERT_OK(RecordBatchStreamReader::Open(source, &reader));
+    } else {
+      ASSERT_OK(RecordBatchStreamReader::Open(source, included_fields, &reader));
+    }
+    reader->set_reuse_buffers(1, pool_);
+
+    int num_batches = 0;
+    std::shared_ptr<RecordBatch> result;
+    while (true) {
+      result.reset();
+      ASSERT_OK(reader->GetNextRecordBatch(&result));
+      if (result == nullptr) { break; }
+      if (read_all) {
+        CompareBatch(*batch, *result);
+      } else {
+        CheckIncludedFields(*batch, included_fields, *result);
+      }
+      ++num_batches;
+    }
+    ASSERT_EQ(3, num_batches);
+  }
+}
+
+TEST_P(TestFileFormat, CompressedRoundTrip) {
+  std::shared_ptr<RecordBatch> batch1;
+  std::shared_ptr<RecordBatch> batch2;
+  ASSERT_OK((*GetParam())(&batch1));  // NOLINT clang-tidy gtest issue
+  ASSERT_OK((*GetParam())(&batch2));  // NOLINT clang-tidy gtest issue
+
+  for (auto compression : {Compression::LZ4, Compression::ZSTD}) {
+    SetUp();  // Fresh sink for each file
+    std::shared_ptr<RecordBatchFileReader> reader;
+    ASSERT_OK(WriteAndOpen({batch1, batch2}, &reader, compression));
+
+    std::shared_ptr<RecordBatch> result;
+    ASSERT_OK(reader->GetRecordBatch(1, &result));
+    CompareBatch(*batch2, *result);
+
+    const std::vector<int> included_fields = SomeFieldIndices(*batch1);
+    ASSERT_OK(reader->GetRecordBatch(0, included_fields, &result));
+    CheckIncludedFields(*batch1, included_fields, *result);
+  }
+}
+
+TEST_P(TestStreamFormat, CompressedRoundTrip) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK((*GetParam())(&batch));  // NOLINT clang-tidy gtest issue
+  ASSERT_OK(WriteStream(*batch, 3, Compression::GZIP));
+
+  std::shared_ptr<RecordBatchStreamReader> reader;
+  ASSERT_OK(RecordBatchStreamReader::Open(
+      std::make_shared<io::BufferReader>(buffer_), &reader));
+
+  int num_batches = 0;
+  std::shared_ptr<RecordBatch> result;
+  while (true) {
+    ASSERT_OK(reader->GetNextRecordBatch(&result));
+    if (result == nullptr) { break; }
+    CompareBatch(*batch, *result);
+    ++num_batches;
+  }
+  ASSERT_EQ(3, num_batches);
+}
+
+TEST_F(TestStreamFormat, CompressedMetadataVersion) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+  ASSERT_OK(WriteStream(*batch, 1, Compression::LZ4));
+
+  io::BufferReader stream(buffer_);
+  std::shared_ptr<Message> message;
+
+  // The schema is unchanged, only the compressed batch needs the newer version
+  ASSERT_OK(ReadMessage(&stream, &message));
+  ASSERT_EQ(Message::SCHEMA, message->type());
+  ASSERT_EQ(MetadataVersion::V3, message->metadata_version());
+
+  ASSERT_OK(ReadMessage(&stream, &message));
+  ASSERT_EQ(Message::RECORD_BATCH, message->type());
+  ASSERT_EQ(MetadataVersion::V4, message->metadata_version());
+}
+
 INSTANTIATE_TEST_CASE_P(GenericIpcRoundTripTests, TestIpcRoundTrip, BATCH_CASES());
 INSTANTIATE_TEST_CASE_P(FileRoundTripTests, TestFileFormat, BATCH_CASES());
 INSTANTIATE_TEST_CASE_P(StreamRoundTripTests, TestStreamFormat, BATCH_CASES());
@@ -660,6 +841,222 @@ TEST_F(TestStreamFormat, DictionaryRoundTrip) {
   CheckBatchDictionaries(*out_batches[0]);
 }
 
+// Columns large enough that the gaps left by excluded ones are skipped
+static Status MakeWideColumnBatch(std::shared_ptr<RecordBatch>* out) {
+  const int64_t length = 10000;
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<Array>> arrays(4);
+  for (int i = 0; i < 4; ++i) {
+    RETURN_NOT_OK(
+        MakeRandomInt32Array(length, i % 2 == 0, default_memory_pool(), &arrays[i]));
+    std::stringstream name;
+    name << "f" << i;
+    fields.push_back(field(name.str(), int32()));
+  }
+  *out = std::make_shared<RecordBatch>(std::make_shared<Schema>(fields), length, arrays);
+  return Status::OK();
+}
+
+TEST_F(TestFileFormat, ReadIncludedFieldsWideColumns) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeWideColumnBatch(&batch));
+
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(WriteAndOpen({batch, batch}, &reader));
+
+  for (const std::vector<int>& included_fields :
+      std::vector<std::vector<int>>{{1}, {3, 0}, {2}, {}}) {
+    std::shared_ptr<RecordBatch> result;
+    ASSERT_OK(reader->GetRecordBatch(1, included_fields, &result));
+    CheckIncludedFields(*batch, included_fields, *result);
+  }
+
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_RAISES(Invalid, reader->GetRecordBatch(0, {4}, &result));
+  ASSERT_RAISES(Invalid, reader->GetRecordBatch(0, {1, 1}, &result));
+}
+
+TEST_F(TestFileFormat, ReadBatches) {
+  BatchVector in_batches(4);
+  for (auto& batch : in_batches) {
+    ASSERT_OK(MakeWideColumnBatch(&batch));
+  }
+
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(WriteAndOpen(in_batches, &reader));
+
+  std::shared_ptr<Table> expected;
+  ASSERT_OK(Table::FromRecordBatches({in_batches[3], in_batches[1]}, &expected));
+  for (int num_threads : {1, 3, 16}) {
+    std::shared_ptr<Table> table;
+    ASSERT_OK(reader->ReadBatches({3, 1}, num_threads, &table));
+    ASSERT_TRUE(table->Equals(*expected));
+  }
+
+  std::shared_ptr<Table> table;
+  ASSERT_OK(reader->ReadBatches({}, 4, &table));
+  ASSERT_EQ(0, table->num_rows());
+  ASSERT_EQ(4, table->num_columns());
+
+  ASSERT_RAISES(Invalid, reader->ReadBatches({4}, 4, &table));
+  ASSERT_RAISES(Invalid, reader->ReadBatches({0}, 0, &table));
+}
+
+TEST_F(TestStreamFormat, ReadIncludedFieldsWideColumns) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeWideColumnBatch(&batch));
+  ASSERT_OK(WriteStream(*batch, 3));
+
+  for (const std::vector<int>& included_fields :
+      std::vector<std::vector<int>>{{1}, {3, 0}, {2}}) {
+    std::shared_ptr<RecordBatchStreamReader> reader;
+    ASSERT_OK(RecordBatchStreamReader::Open(
+        std::make_shared<io::BufferReader>(buffer_), included_fields, &reader));
+
+    int num_batches = 0;
+    std::shared_ptr<RecordBatch> result;
+    while (true) {
+      ASSERT_OK(reader->GetNextRecordBatch(&result));
+      if (result == nullptr) { break; }
+      CheckIncludedFields(*batch, included_fields, *result);
+      ++num_batches;
+    }
+    ASSERT_EQ(3, num_batches);
+  }
+
+  std::shared_ptr<RecordBatchStreamReader> reader;
+  ASSERT_RAISES(Invalid, RecordBatchStreamReader::Open(
+                             std::make_shared<io::BufferReader>(buffer_), {-1}, &reader));
+}
+
+// Repetitive columns totalling a few MB, so that compressed bodies are much
+// smaller and decompressed on several threads
+static Status MakeCompressibleBatch(std::shared_ptr<RecordBatch>* out) {
+  const int64_t length = 100000;
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<Array>> arrays;
+  for (int i = 0; i < 4; ++i) {
+    Int64Builder builder(default_memory_pool());
+    for (int64_t j = 0; j < length; ++j) {
+      if (j % 7 == i) {
+        RETURN_NOT_OK(builder.AppendNull());
+      } else {
+        RETURN_NOT_OK(builder.Append(j % 100));
+      }
+    }
+    arrays.emplace_back();
+    RETURN_NOT_OK(builder.Finish(&arrays.back()));
+    std::stringstream name;
+    name << "f" << i;
+    fields.push_back(field(name.str(), int64()));
+  }
+  *out = std::make_shared<RecordBatch>(std::make_shared<Schema>(fields), length, arrays);
+  return Status::OK();
+}
+
+TEST_F(TestFileFormat, CompressedLargeBatches) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeCompressibleBatch(&batch));
+
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(WriteAndOpen({batch, batch}, &reader, Compression::ZSTD));
+
+  int64_t batch_size;
+  ASSERT_OK(GetRecordBatchSize(*batch, &batch_size));
+  int64_t file_size;
+  ASSERT_OK(sink_->Tell(&file_size));
+  ASSERT_LT(file_size, 2 * batch_size / 5);
+
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(reader->GetRecordBatch(1, &result));
+  CompareBatch(*batch, *result);
+
+  const std::vector<int> included_fields = {2, 1};
+  ASSERT_OK(reader->GetRecordBatch(0, included_fields, &result));
+  CheckIncludedFields(*batch, included_fields, *result);
+
+  std::shared_ptr<Table> expected;
+  ASSERT_OK(Table::FromRecordBatches({batch, batch}, &expected));
+  std::shared_ptr<Table> table;
+  ASSERT_OK(reader->ReadAll(4, &table));
+  ASSERT_TRUE(table->Equals(*expected));
+}
+
+TEST_F(TestFileFormat, CompressedMemoryPool) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeCompressibleBatch(&batch));
+
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(WriteAndOpen({batch}, &reader, Compression::ZSTD));
+
+  ProxyMemoryPool pool;
+  reader->set_memory_pool(&pool);
+
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(reader->GetRecordBatch(0, &result));
+  CompareBatch(*batch, *result);
+  ASSERT_GT(pool.bytes_allocated(), 0);
+
+  result.reset();
+  ASSERT_EQ(0, pool.bytes_allocated());
+}
+
+TEST_F(TestStreamFormat, CompressedMemoryPool) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeCompressibleBatch(&batch));
+  ASSERT_OK(WriteStream(*batch, 1, Compression::LZ4));
+
+  std::shared_ptr<RecordBatchStreamReader> reader;
+  ASSERT_OK(RecordBatchStreamReader::Open(
+      std::make_shared<io::BufferReader>(buffer_), &reader));
+
+  ProxyMemoryPool pool;
+  reader->set_memory_pool(&pool);
+
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(reader->GetNextRecordBatch(&result));
+  CompareBatch(*batch, *result);
+  ASSERT_GT(pool.bytes_allocated(), 0);
+
+  result.reset();
+  ASSERT_EQ(0, pool.bytes_allocated());
+}
+
+TEST_F(TestStreamFormat, CompressedIncludedFields) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeCompressibleBatch(&batch));
+  ASSERT_OK(WriteStream(*batch, 2, Compression::LZ4));
+
+  const std::vector<int> included_fields = {3, 0};
+  std::shared_ptr<RecordBatchStreamReader> reader;
+  ASSERT_OK(RecordBatchStreamReader::Open(
+      std::make_shared<io::BufferReader>(buffer_), included_fields, &reader));
+
+  int num_batches = 0;
+  std::shared_ptr<RecordBatch> result;
+  while (true) {
+    ASSERT_OK(reader->GetNextRecordBatch(&result));
+    if (result == nullptr) { break; }
+    CheckIncludedFields(*batch, included_fields, *result);
+    ++num_batches;
+  }
+  ASSERT_EQ(2, num_batches);
+}
+
+TEST_F(TestStreamFormat, CompressedDictionaryRoundTrip) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeDictionary(&batch));
+  ASSERT_OK(WriteStream(*batch, 1, Compression::ZSTD));
+
+  std::shared_ptr<RecordBatchStreamReader> reader;
+  ASSERT_OK(RecordBatchStreamReader::Open(
+      std::make_shared<io::BufferReader>(buffer_), &reader));
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(reader->GetNextRecordBatch(&result));
+  CompareBatch(*batch, *result);
+  CheckBatchDictionaries(*result);
+}
+
 TEST_F(TestFileFormat, DictionaryRoundTrip) {
   std::shared_ptr<RecordBatch> batch;
   ASSERT_OK(MakeDictionary(&batch));
@@ -670,6 +1067,212 @@ TEST_F(TestFileFormat, DictionaryRoundTrip) {
   CheckBatchDictionaries(*out_batches[0]);
 }
 
+static const uint8_t* ColumnData(const RecordBatch& batch) {
+  return static_cast<const PrimitiveArray&>(*batch.column(0)).data()->data();
+}
+
+TEST_F(TestStreamFormat, ReuseBuffersAfterRelease) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntBatchSized(1000, &batch));
+  ASSERT_OK(WriteStream(*batch, 10));
+
+  InstrumentedMemoryPool pool;
+  std::shared_ptr<RecordBatchStreamReader> reader;
+  auto source = std::make_shared<io::BufferReader>(buffer_);
+  ASSERT_OK(RecordBatchStreamReader::Open(source, &reader));
+  reader->set_reuse_buffers(2, &pool);
+
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(reader->GetNextRecordBatch(&result));
+  CompareBatch(*batch, *result);
+  const MemoryPoolStats stats = pool.GetStats();
+
+  // Each body is read into the buffer released by the previous record batch,
+  // without allocating
+  for (int i = 0; i < 5; ++i) {
+    const uint8_t* previous_data = ColumnData(*result);
+    result.reset();
+    ASSERT_OK(reader->GetNextRecordBatch(&result));
+    CompareBatch(*batch, *result);
+    ASSERT_EQ(previous_data, ColumnData(*result));
+  }
+  ASSERT_EQ(stats.num_allocations, pool.GetStats().num_allocations);
+  ASSERT_EQ(stats.num_reallocations, pool.GetStats().num_reallocations);
+
+  // A record batch that is still held keeps its buffer
+  std::shared_ptr<RecordBatch> held = result;
+  ASSERT_OK(reader->GetNextRecordBatch(&result));
+  ASSERT_NE(ColumnData(*held), ColumnData(*result));
+
+  // With both kept buffers in use, the body is read into a new one
+  std::shared_ptr<RecordBatch> held2 = result;
+  ASSERT_OK(reader->GetNextRecordBatch(&result));
+  ASSERT_NE(ColumnData(*held), ColumnData(*result));
+  ASSERT_NE(ColumnData(*held2), ColumnData(*result));
+  CompareBatch(*batch, *held);
+  CompareBatch(*batch, *held2);
+  CompareBatch(*batch, *result);
+}
+
+// A record batch with one column of the values encoded by the builder, which
+// keeps its dictionary across batches
+static Status FinishDictionaryBatch(StringDictionaryBuilder* builder,
+    const std::vector<std::string>& values, std::shared_ptr<RecordBatch>* out) {
+  for (const std::string& value : values) {
+    RETURN_NOT_OK(builder->Append(value));
+  }
+  std::shared_ptr<Array> array;
+  RETURN_NOT_OK(builder->Finish(&array));
+  auto schema = std::make_shared<Schema>(
+      std::vector<std::shared_ptr<Field>>({field("f0", array->type())}));
+  *out = std::make_shared<RecordBatch>(
+      schema, array->length(), std::vector<std::shared_ptr<Array>>({array}));
+  return Status::OK();
+}
+
+static Status MakeDictionaryDeltaBatches(MemoryPool* pool, BatchVector* out) {
+  StringDictionaryBuilder builder(pool);
+  out->resize(3);
+  RETURN_NOT_OK(FinishDictionaryBatch(&builder, {"a", "b", "a"}, &(*out)[0]));
+  RETURN_NOT_OK(FinishDictionaryBatch(&builder, {"c", "a", "d"}, &(*out)[1]));
+  // No new entries, so nothing is sent for the dictionary
+  return FinishDictionaryBatch(&builder, {"b", "d"}, &(*out)[2]);
+}
+
+static const Array& ColumnIndices(const RecordBatch& batch) {
+  return *static_cast<const DictionaryArray&>(*batch.column(0)).indices();
+}
+
+TEST_F(TestStreamFormat, DictionaryDeltas) {
+  BatchVector batches;
+  ASSERT_OK(MakeDictionaryDeltaBatches(pool_, &batches));
+
+  std::shared_ptr<RecordBatchStreamWriter> writer;
+  ASSERT_OK(RecordBatchStreamWriter::Open(sink_.get(), batches[0]->schema(), &writer));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(sink_->Close());
+
+  // The dictionary, one delta and the record batches
+  io::BufferReader messages(buffer_);
+  std::vector<Message::Type> types;
+  std::shared_ptr<Message> message;
+  ASSERT_OK(ReadMessage(&messages, &message));
+  while (message != nullptr) {
+    types.push_back(message->type());
+    ASSERT_OK(messages.Advance(message->body_length()));
+    ASSERT_OK(ReadMessage(&messages, &message));
+  }
+  std::vector<Message::Type> expected_types = {Message::SCHEMA, Message::DICTIONARY_BATCH,
+      Message::RECORD_BATCH, Message::DICTIONARY_BATCH, Message::RECORD_BATCH,
+      Message::RECORD_BATCH};
+  ASSERT_EQ(expected_types, types);
+
+  // The concatenated dictionary comes from the reader's pool
+  ProxyMemoryPool pool;
+  std::shared_ptr<RecordBatchStreamReader> reader;
+  auto source = std::make_shared<io::BufferReader>(buffer_);
+  ASSERT_OK(RecordBatchStreamReader::Open(source, &reader));
+  reader->set_memory_pool(&pool);
+  for (const auto& batch : batches) {
+    std::shared_ptr<RecordBatch> result;
+    ASSERT_OK(reader->GetNextRecordBatch(&result));
+    CompareBatch(*batch, *result);
+  }
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(reader->GetNextRecordBatch(&result));
+  ASSERT_EQ(nullptr, result);
+  ASSERT_GT(pool.bytes_allocated(), 0);
+}
+
+TEST_F(TestStreamFormat, DictionaryReplacement) {
+  StringDictionaryBuilder builder1(pool_);
+  StringDictionaryBuilder builder2(pool_);
+  BatchVector batches(3);
+  ASSERT_OK(FinishDictionaryBatch(&builder1, {"a", "b", "a"}, &batches[0]));
+  ASSERT_OK(FinishDictionaryBatch(&builder2, {"x", "y"}, &batches[1]));
+  ASSERT_OK(FinishDictionaryBatch(&builder2, {"z", "x"}, &batches[2]));
+
+  std::shared_ptr<RecordBatchStreamWriter> writer;
+  ASSERT_OK(RecordBatchStreamWriter::Open(sink_.get(), batches[0]->schema(), &writer));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(sink_->Close());
+
+  std::shared_ptr<RecordBatchStreamReader> reader;
+  auto source = std::make_shared<io::BufferReader>(buffer_);
+  ASSERT_OK(RecordBatchStreamReader::Open(source, &reader));
+  for (const auto& batch : batches) {
+    std::shared_ptr<RecordBatch> result;
+    ASSERT_OK(reader->GetNextRecordBatch(&result));
+    CompareBatch(*batch, *result);
+  }
+}
+
+TEST_F(TestStreamFormat, DictionaryDeltaLargeDictionary) {
+  StringDictionaryBuilder builder(pool_);
+  BatchVector batches(2);
+  ASSERT_OK(FinishDictionaryBatch(&builder, {"a"}, &batches[0]));
+
+  // More entries than fit in 8-bit indices
+  std::vector<std::string> values;
+  for (int i = 0; i < 300; ++i) {
+    values.push_back(std::to_string(i));
+  }
+  ASSERT_OK(FinishDictionaryBatch(&builder, values, &batches[1]));
+
+  std::shared_ptr<RecordBatchStreamWriter> writer;
+  ASSERT_OK(RecordBatchStreamWriter::Open(sink_.get(), batches[0]->schema(), &writer));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(sink_->Close());
+
+  std::shared_ptr<RecordBatchStreamReader> reader;
+  auto source = std::make_shared<io::BufferReader>(buffer_);
+  ASSERT_OK(RecordBatchStreamReader::Open(source, &reader));
+  for (const auto& batch : batches) {
+    std::shared_ptr<RecordBatch> result;
+    ASSERT_OK(reader->GetNextRecordBatch(&result));
+    CompareBatch(*batch, *result);
+  }
+}
+
+TEST_F(TestFileFormat, DictionaryDeltas) {
+  BatchVector batches;
+  ASSERT_OK(MakeDictionaryDeltaBatches(pool_, &batches));
+
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(WriteAndOpen(batches, &reader));
+
+  // The deltas are all applied when the file is opened, so every record batch
+  // has the last dictionary
+  for (int i = 0; i < static_cast<int>(batches.size()); ++i) {
+    std::shared_ptr<RecordBatch> result;
+    ASSERT_OK(reader->GetRecordBatch(i, &result));
+    ASSERT_TRUE(ColumnIndices(*batches[i]).Equals(ColumnIndices(*result)));
+  }
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(reader->GetRecordBatch(2, &result));
+  CompareBatch(*batches[2], *result);
+}
+
+TEST_F(TestFileFormat, DictionaryReplacementNotAllowed) {
+  StringDictionaryBuilder builder1(pool_);
+  StringDictionaryBuilder builder2(pool_);
+  BatchVector batches(2);
+  ASSERT_OK(FinishDictionaryBatch(&builder1, {"a", "b"}, &batches[0]));
+  ASSERT_OK(FinishDictionaryBatch(&builder2, {"x"}, &batches[1]));
+
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_RAISES(Invalid, WriteAndOpen(batches, &reader));
+}
+
 class TestTensorRoundTrip : public ::testing::Test, public IpcTestFixture {
  public:
   void SetUp() { pool_ = default_memory_pool(); }
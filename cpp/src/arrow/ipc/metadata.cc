@@ -57,6 +57,14 @@ static constexpr flatbuf::MetadataVersion kCurrentMetadataVersion =
 static constexpr flatbuf::MetadataVersion kMinMetadataVersion =
     flatbuf::MetadataVersion_V3;
 
+// Messages with a compressed body are written with this version, so that readers
+// which do not know about body compression reject them
+static constexpr flatbuf::MetadataVersion kCompressedBodyMetadataVersion =
+    flatbuf::MetadataVersion_V4;
+
+static constexpr flatbuf::MetadataVersion kMaxMetadataVersion =
+    flatbuf::MetadataVersion_V4;
+
 static Status IntFromFlatbuffer(
     const flatbuf::Int* int_data, std::shared_ptr<DataType>* out) {
   if (int_data->bitWidth() > 64) {
@@ -479,11 +487,11 @@ static DictionaryOffset GetDictionaryEncoding(
   int64_t dictionary_id = memo->GetId(type.dictionary());
 
   // We assume that the dictionary index type (as an integer) has already been
-  // validated elsewhere, and can safely assume we are dealing with signed
-  // integers
-  const auto& fw_index_type = static_cast<const FixedWidthType&>(*type.index_type());
+  // validated elsewhere
+  const auto& index_type = static_cast<const IntegerType&>(*type.index_type());
 
-  auto index_type_offset = flatbuf::CreateInt(fbb, fw_index_type.bit_width(), true);
+  auto index_type_offset =
+      flatbuf::CreateInt(fbb, index_type.bit_width(), index_type.is_signed());
 
   // TODO(wesm): ordered dictionaries
   return flatbuf::CreateDictionaryEncoding(fbb, dictionary_id, index_type_offset);
@@ -630,9 +638,9 @@ static Status WriteFlatbufferBuilder(FBB& fbb, std::shared_ptr<Buffer>* out) {
 }
 
 static Status WriteFBMessage(FBB& fbb, flatbuf::MessageHeader header_type,
-    flatbuffers::Offset<void> header, int64_t body_length, std::shared_ptr<Buffer>* out) {
-  auto message = flatbuf::CreateMessage(
-      fbb, kCurrentMetadataVersion, header_type, header, body_length);
+    flatbuffers::Offset<void> header, int64_t body_length, std::shared_ptr<Buffer>* out,
+    flatbuf::MetadataVersion version = kCurrentMetadataVersion) {
+  auto message = flatbuf::CreateMessage(fbb, version, header_type, header, body_length);
   fbb.Finish(message);
   return WriteFlatbufferBuilder(fbb, out);
 }
@@ -678,8 +686,44 @@ static Status WriteBuffers(
   return Status::OK();
 }
 
+static Status CompressionToFlatbuffer(
+    Compression::type compression, flatbuf::CompressionType* out) {
+  switch (compression) {
+    case Compression::UNCOMPRESSED:
+      *out = flatbuf::CompressionType_UNCOMPRESSED;
+      break;
+    case Compression::SNAPPY:
+      *out = flatbuf::CompressionType_SNAPPY;
+      break;
+    case Compression::GZIP:
+      *out = flatbuf::CompressionType_GZIP;
+      break;
+    case Compression::LZO:
+      *out = flatbuf::CompressionType_LZO;
+      break;
+    case Compression::BROTLI:
+      *out = flatbuf::CompressionType_BROTLI;
+      break;
+    case Compression::ZSTD:
+      *out = flatbuf::CompressionType_ZSTD;
+      break;
+    case Compression::LZ4:
+      *out = flatbuf::CompressionType_LZ4;
+      break;
+    default:
+      return Status::Invalid("Unrecognized compression type");
+  }
+  return Status::OK();
+}
+
+static flatbuf::MetadataVersion MessageVersion(Compression::type compression) {
+  return compression == Compression::UNCOMPRESSED ? kCurrentMetadataVersion
+                                                  : kCompressedBodyMetadataVersion;
+}
+
 static Status MakeRecordBatch(FBB& fbb, int64_t length, int64_t body_length,
     const std::vector<FieldMetadata>& nodes, const std::vector<BufferMetadata>& buffers,
+    Compression::type compression, const std::vector<int64_t>& uncompressed_lengths,
     RecordBatchOffset* offset) {
   FieldNodeVector fb_nodes;
   BufferVector fb_buffers;
@@ -687,18 +731,39 @@ static Status MakeRecordBatch(FBB& fbb, int64_t length, int64_t body_length,
   RETURN_NOT_OK(WriteFieldNodes(fbb, nodes, &fb_nodes));
   RETURN_NOT_OK(WriteBuffers(fbb, buffers, &fb_buffers));
 
-  *offset = flatbuf::CreateRecordBatch(fbb, length, fb_nodes, fb_buffers);
+  // Uncompressed bodies omit the table, as written before it existed
+  flatbuffers::Offset<flatbuf::BodyCompression> fb_compression;
+  if (compression != Compression::UNCOMPRESSED) {
+    if (uncompressed_lengths.size() != buffers.size()) {
+      return Status::Invalid("Need the uncompressed length of each buffer");
+    }
+    flatbuf::CompressionType codec;
+    RETURN_NOT_OK(CompressionToFlatbuffer(compression, &codec));
+    fb_compression = flatbuf::CreateBodyCompression(
+        fbb, codec, fbb.CreateVector(uncompressed_lengths));
+  }
+
+  *offset = flatbuf::CreateRecordBatch(fbb, length, fb_nodes, fb_buffers, fb_compression);
   return Status::OK();
 }
 
 Status WriteRecordBatchMessage(int64_t length, int64_t body_length,
     const std::vector<FieldMetadata>& nodes, const std::vector<BufferMetadata>& buffers,
     std::shared_ptr<Buffer>* out) {
+  return WriteRecordBatchMessage(length, body_length, nodes, buffers,
+      Compression::UNCOMPRESSED, std::vector<int64_t>(), out);
+}
+
+Status WriteRecordBatchMessage(int64_t length, int64_t body_length,
+    const std::vector<FieldMetadata>& nodes, const std::vector<BufferMetadata>& buffers,
+    Compression::type compression, const std::vector<int64_t>& uncompressed_lengths,
+    std::shared_ptr<Buffer>* out) {
   FBB fbb;
   RecordBatchOffset record_batch;
-  RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, &record_batch));
-  return WriteFBMessage(
-      fbb, flatbuf::MessageHeader_RecordBatch, record_batch.Union(), body_length, out);
+  RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, compression,
+      uncompressed_lengths, &record_batch));
+  return WriteFBMessage(fbb, flatbuf::MessageHeader_RecordBatch, record_batch.Union(),
+      body_length, out, MessageVersion(compression));
 }
 
 Status WriteTensorMessage(
@@ -730,15 +795,19 @@ Status WriteTensorMessage(
       fbb, flatbuf::MessageHeader_Tensor, fb_tensor.Union(), body_length, out);
 }
 
-Status WriteDictionaryMessage(int64_t id, int64_t length, int64_t body_length,
-    const std::vector<FieldMetadata>& nodes, const std::vector<BufferMetadata>& buffers,
+Status WriteDictionaryMessage(int64_t id, bool is_delta, int64_t length,
+    int64_t body_length, const std::vector<FieldMetadata>& nodes,
+    const std::vector<BufferMetadata>& buffers,
+    Compression::type compression, const std::vector<int64_t>& uncompressed_lengths,
     std::shared_ptr<Buffer>* out) {
   FBB fbb;
   RecordBatchOffset record_batch;
-  RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, &record_batch));
-  auto dictionary_batch = flatbuf::CreateDictionaryBatch(fbb, id, record_batch).Union();
-  return WriteFBMessage(
-      fbb, flatbuf::MessageHeader_DictionaryBatch, dictionary_batch, body_length, out);
+  RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, compression,
+      uncompressed_lengths, &record_batch));
+  auto dictionary_batch =
+      flatbuf::CreateDictionaryBatch(fbb, id, record_batch, is_delta).Union();
+  return WriteFBMessage(fbb, flatbuf::MessageHeader_DictionaryBatch, dictionary_batch,
+      body_length, out, MessageVersion(compression));
 }
 
 static flatbuffers::Offset<flatbuffers::Vector<const flatbuf::Block*>>
@@ -829,6 +898,18 @@ Status DictionaryMemo::AddDictionary(
   return Status::OK();
 }
 
+Status DictionaryMemo::UpdateDictionary(
+    int64_t id, const std::shared_ptr<Array>& dictionary) {
+  auto it = id_to_dictionary_.find(id);
+  if (it == id_to_dictionary_.end()) {
+    std::stringstream ss;
+    ss << "Dictionary with id " << id << " not found";
+    return Status::KeyError(ss.str());
+  }
+  it->second = dictionary;
+  return Status::OK();
+}
+
 //----------------------------------------------------------------------
 // Message reader
 
@@ -844,6 +925,9 @@ class Message::MessageImpl {
     if (message_->version() < kMinMetadataVersion) {
       return Status::Invalid("Old metadata version not supported");
     }
+    if (message_->version() > kMaxMetadataVersion) {
+      return Status::Invalid("Metadata version newer than this reader not supported");
+    }
 
     return Status::OK();
   }
@@ -874,6 +958,9 @@ class Message::MessageImpl {
       case flatbuf::MetadataVersion_V3:
         // Arrow 0.3
         return MetadataVersion::V3;
+      case flatbuf::MetadataVersion_V4:
+        // Compressed record batch bodies
+        return MetadataVersion::V4;
       // Add cases as other versions become available
       default:
         return MetadataVersion::V3;
@@ -1047,6 +1134,28 @@ Status ReadMessage(io::InputStream* file, std::shared_ptr<Message>* message) {
   return Message::Open(buffer, 0, message);
 }
 
+Status ReadMessage(io::InputStream* stream,
+    const std::shared_ptr<ResizableBuffer>& scratch, std::shared_ptr<Message>* message) {
+  int32_t message_length = 0;
+  int64_t bytes_read;
+  RETURN_NOT_OK(stream->Read(
+      sizeof(int32_t), &bytes_read, reinterpret_cast<uint8_t*>(&message_length)));
+
+  if (bytes_read != sizeof(int32_t) || message_length == 0) {
+    // End of stream, or the optional 0 EOS control message
+    *message = nullptr;
+    return Status::OK();
+  }
+
+  RETURN_NOT_OK(scratch->Resize(message_length, false));
+  RETURN_NOT_OK(stream->Read(message_length, &bytes_read, scratch->mutable_data()));
+  if (bytes_read != message_length) {
+    return Status::IOError("Unexpected end of stream trying to read message");
+  }
+
+  return Message::Open(scratch, 0, message);
+}
+
 Status WriteMessage(
     const Buffer& message, io::OutputStream* file, int32_t* message_length) {
   // Need to write 4 bytes (message size), the message, plus padding to
@@ -27,6 +27,7 @@
 #include <vector>
 
 #include "arrow/loader.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
@@ -36,6 +37,7 @@ class Array;
 class Buffer;
 class DataType;
 class Field;
+class ResizableBuffer;
 class Schema;
 class Status;
 class Tensor;
@@ -50,7 +52,7 @@ class RandomAccessFile;
 
 namespace ipc {
 
-enum class MetadataVersion : char { V1, V2, V3 };
+enum class MetadataVersion : char { V1, V2, V3, V4 };
 
 static constexpr const char* kArrowMagicBytes = "ARROW1";
 
@@ -87,6 +89,11 @@ class ARROW_EXPORT DictionaryMemo {
   // that dictionary already exists
   Status AddDictionary(int64_t id, const std::shared_ptr<Array>& dictionary);
 
+  // Replace the dictionary with a particular id, as after a dictionary delta
+  // or replacement in a stream. Returns KeyError if there is no dictionary
+  // with that id. GetId still returns the id for the dictionary it replaces
+  Status UpdateDictionary(int64_t id, const std::shared_ptr<Array>& dictionary);
+
   const DictionaryMap& id_to_dictionary() const { return id_to_dictionary_; }
 
   int size() const { return static_cast<int>(id_to_dictionary_.size()); }
@@ -169,6 +176,17 @@ Status ARROW_EXPORT ReadMessage(int64_t offset, int32_t metadata_length,
 Status ARROW_EXPORT ReadMessage(
     io::InputStream* stream, std::shared_ptr<Message>* message);
 
+/// Read length-prefixed message into a scratch buffer, which is resized to the
+/// message length without shrinking its capacity. The message refers to the
+/// scratch buffer, so it is only valid until the buffer is reused
+///
+/// \param[in] stream the stream to read from
+/// \param[in] scratch the buffer to read the message into
+/// \param[out] message the message read, nullptr at the end of the stream
+/// \return Status success or failure
+Status ARROW_EXPORT ReadMessage(io::InputStream* stream,
+    const std::shared_ptr<ResizableBuffer>& scratch, std::shared_ptr<Message>* message);
+
 /// Write a serialized message with a length-prefix and padding to an 8-byte offset
 ///
 /// <message_size: int32><message: const void*><padding>
@@ -189,11 +207,23 @@ Status ARROW_EXPORT WriteRecordBatchMessage(int64_t length, int64_t body_length,
     const std::vector<FieldMetadata>& nodes, const std::vector<BufferMetadata>& buffers,
     std::shared_ptr<Buffer>* out);
 
+/// Record batch metadata for a body whose buffers were each compressed with
+/// the codec. The buffer lengths are the compressed lengths
+///
+/// \param[in] compression the codec used, or UNCOMPRESSED
+/// \param[in] uncompressed_lengths the length of each buffer before compression
+Status ARROW_EXPORT WriteRecordBatchMessage(int64_t length, int64_t body_length,
+    const std::vector<FieldMetadata>& nodes, const std::vector<BufferMetadata>& buffers,
+    Compression::type compression, const std::vector<int64_t>& uncompressed_lengths,
+    std::shared_ptr<Buffer>* out);
+
 Status ARROW_EXPORT WriteTensorMessage(
     const Tensor& tensor, int64_t buffer_start_offset, std::shared_ptr<Buffer>* out);
 
-Status WriteDictionaryMessage(int64_t id, int64_t length, int64_t body_length,
-    const std::vector<FieldMetadata>& nodes, const std::vector<BufferMetadata>& buffers,
+Status WriteDictionaryMessage(int64_t id, bool is_delta, int64_t length,
+    int64_t body_length, const std::vector<FieldMetadata>& nodes,
+    const std::vector<BufferMetadata>& buffers,
+    Compression::type compression, const std::vector<int64_t>& uncompressed_lengths,
     std::shared_ptr<Buffer>* out);
 
 Status WriteFileFooter(const Schema& schema, const std::vector<FileBlock>& dictionaries,
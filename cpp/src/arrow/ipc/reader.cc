@@ -17,12 +17,16 @@
 
 #include "arrow/ipc/reader.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
+#include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
@@ -30,11 +34,16 @@
 #include "arrow/ipc/Message_generated.h"
 #include "arrow/ipc/metadata.h"
 #include "arrow/ipc/util.h"
+#include "arrow/loader.h"
+#include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/tensor.h"
 #include "arrow/type.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow {
 
@@ -75,11 +84,127 @@ class IpcComponentSource : public ArrayComponentSource {
     return Status::OK();
   }
 
- private:
+ protected:
   const flatbuf::RecordBatch* metadata_;
   io::RandomAccessFile* file_;
 };
 
+// Serves buffers that were read before loading, indexed like the buffers in
+// the record batch metadata. Used when only some of the fields are loaded
+class PrefetchedComponentSource : public IpcComponentSource {
+ public:
+  PrefetchedComponentSource(const flatbuf::RecordBatch* metadata,
+      const std::vector<std::shared_ptr<Buffer>>& buffers)
+      : IpcComponentSource(metadata, nullptr), buffers_(buffers) {}
+
+  Status GetBuffer(int buffer_index, std::shared_ptr<Buffer>* out) override {
+    if (buffer_index >= static_cast<int>(buffers_.size())) {
+      return Status::Invalid("Ran out of buffer metadata, likely malformed");
+    }
+    if (metadata_->buffers()->Get(buffer_index)->length() == 0) {
+      *out = nullptr;
+    } else if (buffers_[buffer_index] == nullptr) {
+      return Status::Invalid("Buffer of an excluded field requested");
+    } else {
+      *out = buffers_[buffer_index];
+    }
+    return Status::OK();
+  }
+
+ private:
+  const std::vector<std::shared_ptr<Buffer>>& buffers_;
+};
+
+// ----------------------------------------------------------------------
+// Decompressing the buffers of a record batch body
+
+// Bodies with at least this many uncompressed bytes are decompressed on
+// several threads
+static constexpr int64_t kParallelDecompressionSize = 1 << 20;
+
+static Status CompressionFromFlatbuffer(
+    flatbuf::CompressionType codec, Compression::type* out) {
+  switch (codec) {
+    case flatbuf::CompressionType_UNCOMPRESSED:
+      *out = Compression::UNCOMPRESSED;
+      break;
+    case flatbuf::CompressionType_SNAPPY:
+      *out = Compression::SNAPPY;
+      break;
+    case flatbuf::CompressionType_GZIP:
+      *out = Compression::GZIP;
+      break;
+    case flatbuf::CompressionType_LZO:
+      *out = Compression::LZO;
+      break;
+    case flatbuf::CompressionType_BROTLI:
+      *out = Compression::BROTLI;
+      break;
+    case flatbuf::CompressionType_ZSTD:
+      *out = Compression::ZSTD;
+      break;
+    case flatbuf::CompressionType_LZ4:
+      *out = Compression::LZ4;
+      break;
+    default:
+      return Status::Invalid("Unrecognized body compression type");
+  }
+  return Status::OK();
+}
+
+// If the body was written with a codec, replace its buffers with their
+// decompressed contents. The buffers are indexed like the buffers in the
+// metadata, and null ones (those of excluded fields) are left as they are. The
+// decompressed buffers are allocated from pool
+static Status DecompressBuffers(const flatbuf::RecordBatch* metadata, MemoryPool* pool,
+    std::vector<std::shared_ptr<Buffer>>* buffers) {
+  const flatbuf::BodyCompression* compression = metadata->compression();
+  if (compression == nullptr) { return Status::OK(); }
+
+  Compression::type codec_type;
+  RETURN_NOT_OK(CompressionFromFlatbuffer(compression->codec(), &codec_type));
+  if (codec_type == Compression::UNCOMPRESSED) { return Status::OK(); }
+
+  auto lengths = compression->uncompressedLengths();
+  if (lengths == nullptr || lengths->size() != metadata->buffers()->size() ||
+      lengths->size() != buffers->size()) {
+    return Status::Invalid("Compressed record batch is missing buffer lengths");
+  }
+
+  std::vector<int> indices;
+  int64_t total_length = 0;
+  for (int i = 0; i < static_cast<int>(buffers->size()); ++i) {
+    if ((*buffers)[i] == nullptr || (*buffers)[i]->size() == 0) { continue; }
+    if (lengths->Get(i) < 0) {
+      return Status::Invalid("Negative uncompressed buffer length");
+    }
+    indices.push_back(i);
+    total_length += lengths->Get(i);
+  }
+
+  int num_threads = 1;
+  if (total_length >= kParallelDecompressionSize) {
+    num_threads = std::max(static_cast<int>(std::thread::hardware_concurrency()), 1);
+  }
+
+  // Each thread has its own codec, as some keep state
+  std::vector<std::unique_ptr<Codec>> codecs(num_threads);
+  return ParallelFor(static_cast<int64_t>(indices.size()), num_threads,
+      [&](int thread_index, int64_t i) {
+        std::unique_ptr<Codec>& codec = codecs[thread_index];
+        if (!codec) { RETURN_NOT_OK(Codec::Create(codec_type, &codec)); }
+        const int index = indices[i];
+        const Buffer& input = *(*buffers)[index];
+        const int64_t length = lengths->Get(index);
+        std::shared_ptr<MutableBuffer> output;
+        RETURN_NOT_OK(AllocateBuffer(pool, length, &output));
+        RETURN_NOT_OK(codec->Decompress(
+            input.size(), input.data(), length, output->mutable_data()));
+        (*buffers)[index] = output;
+        return Status::OK();
+      });
+}
+
 Status ReadRecordBatch(const Message& metadata, const std::shared_ptr<Schema>& schema,
     io::RandomAccessFile* file, std::shared_ptr<RecordBatch>* out) {
   return ReadRecordBatch(metadata, schema, kMaxNestingDepth, file, out);
@@ -106,12 +231,168 @@ static Status LoadRecordBatchFromSource(const std::shared_ptr<Schema>& schema,
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Reading a subset of the fields
+
+// The fields of a schema to read, and the schema of the batches they make
+struct IncludedFields {
+  // The column of each schema field in the read batches, -1 if not read
+  std::vector<int> columns;
+  std::shared_ptr<Schema> schema;
+};
+
+static Status SelectFields(const Schema& schema, const std::vector<int>& indices,
+    IncludedFields* out) {
+  out->columns.assign(schema.num_fields(), -1);
+  std::vector<std::shared_ptr<Field>> fields;
+  for (int index : indices) {
+    if (index < 0 || index >= schema.num_fields()) {
+      std::stringstream ss;
+      ss << "Field index " << index << " out of range for schema with "
+         << schema.num_fields() << " fields";
+      return Status::Invalid(ss.str());
+    }
+    if (out->columns[index] != -1) {
+      std::stringstream ss;
+      ss << "Field index " << index << " included more than once";
+      return Status::Invalid(ss.str());
+    }
+    out->columns[index] = static_cast<int>(fields.size());
+    fields.push_back(schema.field(index));
+  }
+  out->schema = std::make_shared<Schema>(fields, schema.metadata());
+  return Status::OK();
+}
+
+static ArrayLoaderContext MakeLoaderContext(
+    ArrayComponentSource* source, int max_recursion_depth) {
+  ArrayLoaderContext context;
+  context.source = source;
+  context.field_index = 0;
+  context.buffer_index = 0;
+  context.max_recursion_depth = max_recursion_depth;
+  return context;
+}
+
+// The indices in the record batch metadata of the buffers of the included
+// fields, in order
+static Status GetIncludedBuffers(const Schema& schema, const IncludedFields& included,
+    int max_recursion_depth, std::vector<int>* buffer_indices) {
+  ArrayLoaderContext context = MakeLoaderContext(nullptr, max_recursion_depth);
+  for (int i = 0; i < schema.num_fields(); ++i) {
+    const int first_buffer = context.buffer_index;
+    RETURN_NOT_OK(SkipArray(schema.field(i)->type(), &context));
+    if (included.columns[i] == -1) { continue; }
+    for (int j = first_buffer; j < context.buffer_index; ++j) {
+      buffer_indices->push_back(j);
+    }
+  }
+  return Status::OK();
+}
+
+// The locations of the buffers in the message body
+static Status GetBufferRanges(const flatbuf::RecordBatch* metadata,
+    const std::vector<int>& buffer_indices, int64_t body_length,
+    std::vector<io::ReadRange>* ranges) {
+  auto buffers = metadata->buffers();
+  for (int index : buffer_indices) {
+    if (index >= static_cast<int>(buffers->size())) {
+      return Status::Invalid("Ran out of buffer metadata, likely malformed");
+    }
+    const flatbuf::Buffer* buffer = buffers->Get(index);
+    if (buffer->offset() < 0 || buffer->length() < 0 ||
+        buffer->offset() + buffer->length() > body_length) {
+      return Status::Invalid("Buffer extends past the end of the message body");
+    }
+    ranges->push_back({buffer->offset(), buffer->length()});
+  }
+  return Status::OK();
+}
+
+static Status LoadRecordBatchFields(const Schema& schema,
+    const IncludedFields& included, int64_t num_rows, int max_recursion_depth,
+    ArrayComponentSource* source, std::shared_ptr<RecordBatch>* out) {
+  std::vector<std::shared_ptr<Array>> arrays(included.schema->num_fields());
+  ArrayLoaderContext context = MakeLoaderContext(source, max_recursion_depth);
+
+  for (int i = 0; i < schema.num_fields(); ++i) {
+    const int column = included.columns[i];
+    if (column == -1) {
+      RETURN_NOT_OK(SkipArray(schema.field(i)->type(), &context));
+      continue;
+    }
+    RETURN_NOT_OK(LoadArray(schema.field(i)->type(), &context, &arrays[column]));
+    DCHECK_EQ(num_rows, arrays[column]->length())
+        << "Array length did not match record batch length";
+  }
+
+  *out = std::make_shared<RecordBatch>(included.schema, num_rows, std::move(arrays));
+  return Status::OK();
+}
+
+// Load the included fields of a record batch from the buffers read for them,
+// which are in the order of GetIncludedBuffers
+static Status LoadRecordBatchFields(const flatbuf::RecordBatch* metadata,
+    const Schema& schema, const IncludedFields& included,
+    const std::vector<int>& buffer_indices,
+    const std::vector<std::shared_ptr<Buffer>>& buffers, MemoryPool* pool,
+    std::shared_ptr<RecordBatch>* out) {
+  std::vector<std::shared_ptr<Buffer>> indexed_buffers(metadata->buffers()->size());
+  for (size_t i = 0; i < buffer_indices.size(); ++i) {
+    indexed_buffers[buffer_indices[i]] = buffers[i];
+  }
+  RETURN_NOT_OK(DecompressBuffers(metadata, pool, &indexed_buffers));
+  PrefetchedComponentSource source(metadata, indexed_buffers);
+  return LoadRecordBatchFields(
+      schema, included, metadata->length(), kMaxNestingDepth, &source, out);
+}
+
+// Read only the buffers of the included fields from a message body at
+// body_offset in the file, then load them
+static Status ReadRecordBatchFields(const Message& message, const Schema& schema,
+    const IncludedFields& included, int64_t body_offset, int64_t body_length,
+    io::RandomAccessFile* file, MemoryPool* pool, std::shared_ptr<RecordBatch>* out) {
+  DCHECK_EQ(message.type(), Message::RECORD_BATCH);
+  auto metadata = reinterpret_cast<const flatbuf::RecordBatch*>(message.header());
+
+  std::vector<int> buffer_indices;
+  RETURN_NOT_OK(GetIncludedBuffers(schema, included, kMaxNestingDepth, &buffer_indices));
+  std::vector<io::ReadRange> ranges;
+  RETURN_NOT_OK(GetBufferRanges(metadata, buffer_indices, body_length, &ranges));
+  for (io::ReadRange& range : ranges) {
+    range.offset += body_offset;
+  }
+
+  // Nearby buffers are coalesced into fewer reads
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  RETURN_NOT_OK(file->ReadRanges(ranges, &buffers));
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    if (buffers[i]->size() < ranges[i].length) {
+      return Status::IOError("Unexpected end of file when reading buffer");
+    }
+  }
+  return LoadRecordBatchFields(
+      metadata, schema, included, buffer_indices, buffers, pool, out);
+}
+
 static inline Status ReadRecordBatch(const flatbuf::RecordBatch* metadata,
     const std::shared_ptr<Schema>& schema, int max_recursion_depth,
-    io::RandomAccessFile* file, std::shared_ptr<RecordBatch>* out) {
+    io::RandomAccessFile* file, MemoryPool* pool, std::shared_ptr<RecordBatch>* out) {
   IpcComponentSource source(metadata, file);
+  if (metadata->compression() == nullptr) {
+    return LoadRecordBatchFromSource(
+        schema, metadata->length(), max_recursion_depth, &source, out);
+  }
+
+  // The buffers of a compressed body are all read, then decompressed together
+  std::vector<std::shared_ptr<Buffer>> buffers(metadata->buffers()->size());
+  for (int i = 0; i < static_cast<int>(buffers.size()); ++i) {
+    RETURN_NOT_OK(source.GetBuffer(i, &buffers[i]));
+  }
+  RETURN_NOT_OK(DecompressBuffers(metadata, pool, &buffers));
+  PrefetchedComponentSource prefetched(metadata, buffers);
   return LoadRecordBatchFromSource(
-      schema, metadata->length(), max_recursion_depth, &source, out);
+      schema, metadata->length(), max_recursion_depth, &prefetched, out);
 }
 
 Status ReadRecordBatch(const Message& metadata, const std::shared_ptr<Schema>& schema,
@@ -119,11 +400,13 @@ Status ReadRecordBatch(const Message& metadata, const std::shared_ptr<Schema>& s
     std::shared_ptr<RecordBatch>* out) {
   DCHECK_EQ(metadata.type(), Message::RECORD_BATCH);
   auto batch = reinterpret_cast<const flatbuf::RecordBatch*>(metadata.header());
-  return ReadRecordBatch(batch, schema, max_recursion_depth, file, out);
+  return ReadRecordBatch(
+      batch, schema, max_recursion_depth, file, default_memory_pool(), out);
 }
 
 Status ReadDictionary(const Message& metadata, const DictionaryTypeMap& dictionary_types,
-    io::RandomAccessFile* file, int64_t* dictionary_id, std::shared_ptr<Array>* out) {
+    io::RandomAccessFile* file, MemoryPool* pool, int64_t* dictionary_id,
+    std::shared_ptr<Array>* out) {
   auto dictionary_batch =
       reinterpret_cast<const flatbuf::DictionaryBatch*>(metadata.header());
 
@@ -145,7 +428,7 @@ Status ReadDictionary(const Message& metadata, const DictionaryTypeMap& dictiona
   auto batch_meta =
       reinterpret_cast<const flatbuf::RecordBatch*>(dictionary_batch->data());
   RETURN_NOT_OK(
-      ReadRecordBatch(batch_meta, dummy_schema, kMaxNestingDepth, file, &batch));
+      ReadRecordBatch(batch_meta, dummy_schema, kMaxNestingDepth, file, pool, &batch));
 
   if (batch->num_columns() != 1) {
     return Status::Invalid("Dictionary record batch must only contain one field");
@@ -155,6 +438,141 @@ Status ReadDictionary(const Message& metadata, const DictionaryTypeMap& dictiona
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Dictionary deltas and replacements
+
+static void CopyBits(const uint8_t* bits, int64_t offset, int64_t length, uint8_t* out,
+    int64_t out_offset) {
+  for (int64_t i = 0; i < length; ++i) {
+    BitUtil::SetBitTo(out, out_offset + i, BitUtil::GetBit(bits, offset + i));
+  }
+}
+
+// Append the entries of a dictionary delta to the previous dictionary.
+// Dictionaries of nested types are not supported
+static Status ConcatenateDictionaries(const Array& previous, const Array& delta,
+    MemoryPool* pool, std::shared_ptr<Array>* out) {
+  const Type::type type_id = previous.type()->id();
+  const int64_t length = previous.length() + delta.length();
+  const std::vector<FieldMetadata> fields = {
+      {length, previous.null_count() + delta.null_count(), 0}};
+  std::vector<std::shared_ptr<Buffer>> buffers;
+
+  // The validity bitmap, left out if there are no nulls
+  std::shared_ptr<MutableBuffer> null_bitmap;
+  if (fields[0].null_count > 0) {
+    RETURN_NOT_OK(AllocateBuffer(pool, BitUtil::BytesForBits(length), &null_bitmap));
+    int64_t position = 0;
+    for (const Array* array : {&previous, &delta}) {
+      for (int64_t i = 0; i < array->length(); ++i) {
+        BitUtil::SetBitTo(null_bitmap->mutable_data(), position++, !array->IsNull(i));
+      }
+    }
+  }
+  buffers.push_back(null_bitmap);
+
+  if (is_binary_like(type_id)) {
+    // The offsets of the concatenated value data must fit in 32 bits
+    int64_t data_length = 0;
+    for (const Array* array : {&previous, &delta}) {
+      const auto& binary = static_cast<const BinaryArray&>(*array);
+      if (binary.length() == 0) { continue; }
+      data_length += binary.value_offset(binary.length()) - binary.value_offset(0);
+    }
+    if (data_length > std::numeric_limits<int32_t>::max()) {
+      return Status::Invalid("Dictionary delta makes the dictionary data too large");
+    }
+
+    // Offsets are rebased onto the concatenated value data
+    std::shared_ptr<MutableBuffer> offsets;
+    RETURN_NOT_OK(AllocateBuffer(pool, sizeof(int32_t) * (length + 1), &offsets));
+    int32_t* out_offsets = reinterpret_cast<int32_t*>(offsets->mutable_data());
+    out_offsets[0] = 0;
+    int64_t position = 0;
+    int32_t value_offset = 0;
+    for (const Array* array : {&previous, &delta}) {
+      const auto& binary = static_cast<const BinaryArray&>(*array);
+      for (int64_t i = 0; i < binary.length(); ++i) {
+        value_offset += binary.value_length(i);
+        out_offsets[++position] = value_offset;
+      }
+    }
+
+    std::shared_ptr<MutableBuffer> data;
+    RETURN_NOT_OK(AllocateBuffer(pool, data_length, &data));
+    uint8_t* out_data = data->mutable_data();
+    for (const Array* array : {&previous, &delta}) {
+      const auto& binary = static_cast<const BinaryArray&>(*array);
+      if (binary.length() == 0) { continue; }
+      const int32_t start = binary.value_offset(0);
+      const int32_t nbytes = binary.value_offset(binary.length()) - start;
+      std::memcpy(out_data, binary.data()->data() + start, nbytes);
+      out_data += nbytes;
+    }
+    buffers.push_back(offsets);
+    buffers.push_back(data);
+  } else if (type_id == Type::BOOL) {
+    std::shared_ptr<MutableBuffer> data;
+    RETURN_NOT_OK(AllocateBuffer(pool, BitUtil::BytesForBits(length), &data));
+    CopyBits(static_cast<const PrimitiveArray&>(previous).data()->data(),
+        previous.offset(), previous.length(), data->mutable_data(), 0);
+    CopyBits(static_cast<const PrimitiveArray&>(delta).data()->data(), delta.offset(),
+        delta.length(), data->mutable_data(), previous.length());
+    buffers.push_back(data);
+  } else if (is_primitive(type_id) && type_id != Type::NA) {
+    const int64_t byte_width =
+        static_cast<const FixedWidthType&>(*previous.type()).bit_width() / 8;
+    std::shared_ptr<MutableBuffer> data;
+    RETURN_NOT_OK(AllocateBuffer(pool, byte_width * length, &data));
+    uint8_t* out_data = data->mutable_data();
+    for (const Array* array : {&previous, &delta}) {
+      if (array->length() == 0) { continue; }
+      const auto& primitive = static_cast<const PrimitiveArray&>(*array);
+      const int64_t nbytes = byte_width * array->length();
+      std::memcpy(
+          out_data, primitive.data()->data() + byte_width * array->offset(), nbytes);
+      out_data += nbytes;
+    }
+    buffers.push_back(data);
+  } else {
+    std::stringstream ss;
+    ss << "Dictionary deltas are not supported for dictionaries of type "
+       << previous.type()->ToString();
+    return Status::NotImplemented(ss.str());
+  }
+
+  return LoadArray(previous.type(), fields, buffers, out);
+}
+
+static bool IsDictionaryDelta(const Message& message) {
+  return reinterpret_cast<const flatbuf::DictionaryBatch*>(message.header())->isDelta();
+}
+
+// Add a dictionary read from a stream or file to the memo. A delta is appended
+// to the dictionary with the same id, and any other dictionary for an id
+// already seen replaces it. A concatenated dictionary is allocated from pool
+static Status AddDictionaryToMemo(int64_t id, bool is_delta,
+    const std::shared_ptr<Array>& dictionary, MemoryPool* pool, DictionaryMemo* memo) {
+  if (!memo->HasDictionaryId(id)) {
+    if (is_delta) {
+      std::stringstream ss;
+      ss << "Dictionary delta for id " << id << " before the dictionary";
+      return Status::Invalid(ss.str());
+    }
+    return memo->AddDictionary(id, dictionary);
+  }
+  if (!is_delta) { return memo->UpdateDictionary(id, dictionary); }
+
+  std::shared_ptr<Array> previous;
+  RETURN_NOT_OK(memo->GetDictionary(id, &previous));
+  if (!previous->type()->Equals(dictionary->type())) {
+    return Status::Invalid("Dictionary delta type does not match the dictionary");
+  }
+  std::shared_ptr<Array> combined;
+  RETURN_NOT_OK(ConcatenateDictionaries(*previous, *dictionary, pool, &combined));
+  return memo->UpdateDictionary(id, combined);
+}
+
 // ----------------------------------------------------------------------
 // RecordBatchStreamReader implementation
 
@@ -178,9 +596,13 @@ static inline std::string FormatMessageType(Message::Type type) {
 
 RecordBatchReader::~RecordBatchReader() {}
 
+// When reading some of the fields, gaps between their buffers up to this size
+// are read and discarded, as one larger read costs less than skipping
+static constexpr int64_t kStreamHoleSizeLimit = 8192;
+
 class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
  public:
-  RecordBatchStreamReaderImpl() {}
+  RecordBatchStreamReaderImpl() : pool_(default_memory_pool()) {}
   ~RecordBatchStreamReaderImpl() {}
 
   Status Open(const std::shared_ptr<io::InputStream>& stream) {
@@ -188,9 +610,26 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
     return ReadSchema();
   }
 
+  Status Open(const std::shared_ptr<io::InputStream>& stream,
+      const std::vector<int>& included_fields) {
+    RETURN_NOT_OK(Open(stream));
+    included_fields_ = included_fields;
+    included_.reset(new IncludedFields());
+    return SelectFields(*schema_, included_fields_, included_.get());
+  }
+
+  void set_memory_pool(MemoryPool* pool) { pool_ = pool; }
+
+  void set_reuse_buffers(int max_buffers, MemoryPool* pool) {
+    max_body_buffers_ = max_buffers;
+    body_pool_ = pool;
+    body_buffers_.clear();
+    metadata_scratch_ = max_buffers > 0 ? std::make_shared<PoolBuffer>(pool) : nullptr;
+  }
+
   Status ReadNextMessage(
       Message::Type expected_type, bool allow_null, std::shared_ptr<Message>* message) {
-    RETURN_NOT_OK(ReadMessage(stream_.get(), message));
+    RETURN_NOT_OK(ReadStreamMessage(message));
 
     if (!(*message) && !allow_null) {
       std::stringstream ss;
@@ -200,16 +639,27 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
     }
 
     if ((*message) == nullptr) { return Status::OK(); }
+    return CheckMessageType(**message, expected_type);
+  }
 
-    if ((*message)->type() != expected_type) {
+  Status CheckMessageType(const Message& message, Message::Type expected_type) {
+    if (message.type() != expected_type) {
       std::stringstream ss;
       ss << "Message not expected type: " << FormatMessageType(expected_type)
-         << ", was: " << (*message)->type();
+         << ", was: " << message.type();
       return Status::IOError(ss.str());
     }
     return Status::OK();
   }
 
+  // When buffers are reused, the message is only valid until the next one is read
+  Status ReadStreamMessage(std::shared_ptr<Message>* message) {
+    if (metadata_scratch_) {
+      return ReadMessage(stream_.get(), metadata_scratch_, message);
+    }
+    return ReadMessage(stream_.get(), message);
+  }
+
   Status ReadExact(int64_t size, std::shared_ptr<Buffer>* buffer) {
     RETURN_NOT_OK(stream_->Read(size, buffer));
 
@@ -219,25 +669,72 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
     return Status::OK();
   }
 
+  Status ReadExact(int64_t size, uint8_t* out) {
+    int64_t bytes_read;
+    RETURN_NOT_OK(stream_->Read(size, &bytes_read, out));
+
+    if (bytes_read < size) {
+      return Status::IOError("Unexpected EOS when reading buffer");
+    }
+    return Status::OK();
+  }
+
+  // A buffer of the given size for a record batch body. A kept buffer is free
+  // for reuse once the reader holds the only reference to it, i.e. all the
+  // arrays read from it were released
+  Status GetBodyBuffer(int64_t size, std::shared_ptr<ResizableBuffer>* out) {
+    out->reset();
+    for (const auto& buffer : body_buffers_) {
+      if (buffer.use_count() == 1) {
+        *out = buffer;
+        break;
+      }
+    }
+    if (*out == nullptr) {
+      *out = std::make_shared<PoolBuffer>(body_pool_);
+      if (static_cast<int>(body_buffers_.size()) < max_body_buffers_) {
+        body_buffers_.push_back(*out);
+      }
+    }
+    // Keep the capacity, so that a buffer reused for a smaller body is not
+    // reallocated when it is reused for a larger one again
+    return (*out)->Resize(size, false);
+  }
+
+  Status ReadBody(int64_t size, std::shared_ptr<Buffer>* body) {
+    if (!metadata_scratch_) { return ReadExact(size, body); }
+    std::shared_ptr<ResizableBuffer> buffer;
+    RETURN_NOT_OK(GetBodyBuffer(size, &buffer));
+    RETURN_NOT_OK(ReadExact(size, buffer->mutable_data()));
+    *body = buffer;
+    return Status::OK();
+  }
+
   Status ReadNextDictionary() {
     std::shared_ptr<Message> message;
     RETURN_NOT_OK(ReadNextMessage(Message::DICTIONARY_BATCH, false, &message));
+    return ReadDictionaryMessage(*message);
+  }
 
+  // Add the dictionary in the message to the memo, appending it to the previous
+  // dictionary with the same id if it is a delta
+  Status ReadDictionaryMessage(const Message& message) {
     std::shared_ptr<Buffer> batch_body;
-    RETURN_NOT_OK(ReadExact(message->body_length(), &batch_body))
+    RETURN_NOT_OK(ReadExact(message.body_length(), &batch_body))
     io::BufferReader reader(batch_body);
 
     std::shared_ptr<Array> dictionary;
     int64_t id;
-    RETURN_NOT_OK(ReadDictionary(*message, dictionary_types_, &reader, &id, &dictionary));
-    return dictionary_memo_.AddDictionary(id, dictionary);
+    RETURN_NOT_OK(
+        ReadDictionary(message, dictionary_types_, &reader, pool_, &id, &dictionary));
+    return AddDictionaryToMemo(
+        id, IsDictionaryDelta(message), dictionary, pool_, &dictionary_memo_);
   }
 
   Status ReadSchema() {
-    std::shared_ptr<Message> message;
-    RETURN_NOT_OK(ReadNextMessage(Message::SCHEMA, false, &message));
+    RETURN_NOT_OK(ReadNextMessage(Message::SCHEMA, false, &schema_message_));
 
-    RETURN_NOT_OK(GetDictionaryTypes(message->header(), &dictionary_types_));
+    RETURN_NOT_OK(GetDictionaryTypes(schema_message_->header(), &dictionary_types_));
 
     // TODO(wesm): In future, we may want to reconcile the ids in the stream with
     // those found in the schema
@@ -246,35 +743,138 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
       RETURN_NOT_OK(ReadNextDictionary());
     }
 
-    return GetSchema(message->header(), dictionary_memo_, &schema_);
+    return GetSchema(schema_message_->header(), dictionary_memo_, &schema_);
+  }
+
+  // Rebuild the schema after dictionaries were updated, so that the record
+  // batches read next refer to the new dictionaries
+  Status UpdateSchema() {
+    RETURN_NOT_OK(GetSchema(schema_message_->header(), dictionary_memo_, &schema_));
+    if (!included_) { return Status::OK(); }
+    included_.reset(new IncludedFields());
+    return SelectFields(*schema_, included_fields_, included_.get());
   }
 
   Status GetNextRecordBatch(std::shared_ptr<RecordBatch>* batch) {
     std::shared_ptr<Message> message;
-    RETURN_NOT_OK(ReadNextMessage(Message::RECORD_BATCH, true, &message));
+    RETURN_NOT_OK(ReadStreamMessage(&message));
+
+    // Dictionary deltas and replacements may come before any record batch
+    bool dictionaries_updated = false;
+    while (message != nullptr && message->type() == Message::DICTIONARY_BATCH) {
+      RETURN_NOT_OK(ReadDictionaryMessage(*message));
+      dictionaries_updated = true;
+      RETURN_NOT_OK(ReadStreamMessage(&message));
+    }
+    if (dictionaries_updated) { RETURN_NOT_OK(UpdateSchema()); }
 
     if (message == nullptr) {
       // End of stream
       *batch = nullptr;
       return Status::OK();
     }
+    RETURN_NOT_OK(CheckMessageType(*message, Message::RECORD_BATCH));
+
+    if (included_) { return ReadRecordBatchFields(*message, batch); }
 
     std::shared_ptr<Buffer> batch_body;
-    RETURN_NOT_OK(ReadExact(message->body_length(), &batch_body));
+    RETURN_NOT_OK(ReadBody(message->body_length(), &batch_body));
     io::BufferReader reader(batch_body);
-    return ReadRecordBatch(*message, schema_, &reader, batch);
+    auto metadata = reinterpret_cast<const flatbuf::RecordBatch*>(message->header());
+    return ReadRecordBatch(metadata, schema_, kMaxNestingDepth, &reader, pool_, batch);
   }
 
-  std::shared_ptr<Schema> schema() const { return schema_; }
+  std::shared_ptr<Schema> schema() const {
+    return included_ ? included_->schema : schema_;
+  }
 
  private:
+  // Read only the buffers of the included fields from the message body,
+  // skipping over the others
+  Status ReadRecordBatchFields(
+      const Message& message, std::shared_ptr<RecordBatch>* batch) {
+    auto metadata = reinterpret_cast<const flatbuf::RecordBatch*>(message.header());
+    const int64_t body_length = message.body_length();
+
+    std::vector<int> buffer_indices;
+    RETURN_NOT_OK(
+        GetIncludedBuffers(*schema_, *included_, kMaxNestingDepth, &buffer_indices));
+    std::vector<io::ReadRange> ranges;
+    RETURN_NOT_OK(GetBufferRanges(metadata, buffer_indices, body_length, &ranges));
+
+    // Small gaps between the buffers are read rather than skipped
+    std::vector<io::ReadRange> coalesced = io::CoalesceReadRanges(
+        ranges, kStreamHoleSizeLimit, std::numeric_limits<int64_t>::max());
+    std::vector<std::shared_ptr<Buffer>> coalesced_buffers(coalesced.size());
+
+    // When buffers are reused, the ranges are read into one body buffer
+    std::shared_ptr<ResizableBuffer> body;
+    if (metadata_scratch_) {
+      int64_t read_length = 0;
+      for (const io::ReadRange& range : coalesced) {
+        read_length += range.length;
+      }
+      RETURN_NOT_OK(GetBodyBuffer(read_length, &body));
+    }
+
+    int64_t position = 0;
+    int64_t body_position = 0;
+    for (size_t i = 0; i < coalesced.size(); ++i) {
+      if (coalesced[i].offset > position) {
+        RETURN_NOT_OK(stream_->Advance(coalesced[i].offset - position));
+      }
+      if (body) {
+        RETURN_NOT_OK(
+            ReadExact(coalesced[i].length, body->mutable_data() + body_position));
+        coalesced_buffers[i] = SliceBuffer(body, body_position, coalesced[i].length);
+        body_position += coalesced[i].length;
+      } else {
+        RETURN_NOT_OK(ReadExact(coalesced[i].length, &coalesced_buffers[i]));
+      }
+      position = coalesced[i].offset + coalesced[i].length;
+    }
+    if (body_length > position) {
+      RETURN_NOT_OK(stream_->Advance(body_length - position));
+    }
+
+    std::vector<std::shared_ptr<Buffer>> buffers;
+    for (const io::ReadRange& range : ranges) {
+      if (range.length == 0) {
+        buffers.push_back(nullptr);
+        continue;
+      }
+      // The last coalesced range starting at or before this one contains it
+      auto it = std::upper_bound(coalesced.begin(), coalesced.end(), range.offset,
+          [](int64_t offset, const io::ReadRange& r) { return offset < r.offset; });
+      const size_t index = static_cast<size_t>(it - coalesced.begin()) - 1;
+      buffers.push_back(SliceBuffer(coalesced_buffers[index],
+          range.offset - coalesced[index].offset, range.length));
+    }
+    return LoadRecordBatchFields(
+        metadata, *schema_, *included_, buffer_indices, buffers, pool_, batch);
+  }
+
   // dictionary_id -> type
   DictionaryTypeMap dictionary_types_;
 
   DictionaryMemo dictionary_memo_;
 
   std::shared_ptr<io::InputStream> stream_;
+  std::shared_ptr<Message> schema_message_;
   std::shared_ptr<Schema> schema_;
+
+  // Set when only some of the fields are read
+  std::vector<int> included_fields_;
+  std::unique_ptr<IncludedFields> included_;
+
+  // For decompressed buffers and concatenated dictionaries
+  MemoryPool* pool_;
+
+  // Set when buffers are reused
+  std::shared_ptr<ResizableBuffer> metadata_scratch_;
+  std::vector<std::shared_ptr<ResizableBuffer>> body_buffers_;
+  int max_body_buffers_ = 0;
+  MemoryPool* body_pool_ = nullptr;
 };
 
 RecordBatchStreamReader::RecordBatchStreamReader() {
@@ -290,6 +890,22 @@ Status RecordBatchStreamReader::Open(const std::shared_ptr<io::InputStream>& str
   return (*reader)->impl_->Open(stream);
 }
 
+Status RecordBatchStreamReader::Open(const std::shared_ptr<io::InputStream>& stream,
+    const std::vector<int>& included_fields,
+    std::shared_ptr<RecordBatchStreamReader>* reader) {
+  // Private ctor
+  *reader = std::shared_ptr<RecordBatchStreamReader>(new RecordBatchStreamReader());
+  return (*reader)->impl_->Open(stream, included_fields);
+}
+
+void RecordBatchStreamReader::set_memory_pool(MemoryPool* pool) {
+  impl_->set_memory_pool(pool);
+}
+
+void RecordBatchStreamReader::set_reuse_buffers(int max_buffers, MemoryPool* pool) {
+  impl_->set_reuse_buffers(max_buffers, pool);
+}
+
 std::shared_ptr<Schema> RecordBatchStreamReader::schema() const {
   return impl_->schema();
 }
@@ -303,7 +919,11 @@ Status RecordBatchStreamReader::GetNextRecordBatch(std::shared_ptr<RecordBatch>*
 
 class RecordBatchFileReader::RecordBatchFileReaderImpl {
  public:
-  RecordBatchFileReaderImpl() { dictionary_memo_ = std::make_shared<DictionaryMemo>(); }
+  RecordBatchFileReaderImpl() : pool_(default_memory_pool()) {
+    dictionary_memo_ = std::make_shared<DictionaryMemo>();
+  }
+
+  void set_memory_pool(MemoryPool* pool) { pool_ = pool; }
 
   Status ReadFooter() {
     int magic_size = static_cast<int>(strlen(kArrowMagicBytes));
@@ -353,6 +973,9 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
       case flatbuf::MetadataVersion_V3:
         // Arrow 0.3
         return MetadataVersion::V3;
+      case flatbuf::MetadataVersion_V4:
+        // Compressed record batch bodies
+        return MetadataVersion::V4;
       // Add cases as other versions become available
       default:
         return MetadataVersion::V3;
@@ -379,10 +1002,101 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
     // TODO(wesm): ARROW-388 -- the buffer frame of reference is 0 (see
     // ARROW-384).
     std::shared_ptr<Buffer> buffer_block;
-    RETURN_NOT_OK(file_->Read(block.body_length, &buffer_block));
+    RETURN_NOT_OK(file_->ReadAt(
+        block.offset + block.metadata_length, block.body_length, &buffer_block));
     io::BufferReader reader(buffer_block);
 
-    return ReadRecordBatch(*message, schema_, &reader, batch);
+    DCHECK_EQ(message->type(), Message::RECORD_BATCH);
+    auto metadata = reinterpret_cast<const flatbuf::RecordBatch*>(message->header());
+    return ReadRecordBatch(metadata, schema_, kMaxNestingDepth, &reader, pool_, batch);
+  }
+
+  Status GetRecordBatch(int i, const std::vector<int>& included_fields,
+      std::shared_ptr<RecordBatch>* batch) {
+    DCHECK_GE(i, 0);
+    DCHECK_LT(i, num_record_batches());
+    FileBlock block = record_batch(i);
+
+    IncludedFields included;
+    RETURN_NOT_OK(SelectFields(*schema_, included_fields, &included));
+
+    std::shared_ptr<Message> message;
+    RETURN_NOT_OK(
+        ReadMessage(block.offset, block.metadata_length, file_.get(), &message));
+    return ReadRecordBatchFields(*message, *schema_, included,
+        block.offset + block.metadata_length, block.body_length, file_.get(), pool_,
+        batch);
+  }
+
+  Status ReadBatches(const std::vector<int>& indices, int num_threads,
+      std::shared_ptr<Table>* table) {
+    if (num_threads <= 0) {
+      return Status::Invalid("Number of threads must be positive");
+    }
+    for (int index : indices) {
+      if (index < 0 || index >= num_record_batches()) {
+        std::stringstream ss;
+        ss << "Record batch index " << index << " out of range for file with "
+           << num_record_batches() << " record batches";
+        return Status::Invalid(ss.str());
+      }
+    }
+
+    const int num_batches = static_cast<int>(indices.size());
+    const int num_fields = schema_->num_fields();
+
+    // With fewer batches than threads, each batch is read as several groups of
+    // fields so that all threads have work
+    int num_groups = 1;
+    if (num_batches > 0 && num_batches < num_threads && num_fields > 1) {
+      num_groups = std::min(num_fields, (num_threads + num_batches - 1) / num_batches);
+    }
+    auto GroupFields = [&](int group, std::vector<int>* fields) {
+      const int begin = group * num_fields / num_groups;
+      const int end = (group + 1) * num_fields / num_groups;
+      for (int i = begin; i < end; ++i) {
+        fields->push_back(i);
+      }
+    };
+
+    const int num_pieces = num_batches * num_groups;
+    std::vector<std::shared_ptr<RecordBatch>> pieces(num_pieces);
+    RETURN_NOT_OK(ParallelFor(num_pieces, num_threads, [&](int, int64_t i) {
+      const int batch_index = indices[i / num_groups];
+      if (num_groups == 1) { return GetRecordBatch(batch_index, &pieces[i]); }
+      std::vector<int> fields;
+      GroupFields(static_cast<int>(i % num_groups), &fields);
+      return GetRecordBatch(batch_index, fields, &pieces[i]);
+    }));
+
+    if (num_batches == 0) {
+      std::vector<std::shared_ptr<Column>> columns;
+      for (int i = 0; i < num_fields; ++i) {
+        columns.push_back(std::make_shared<Column>(
+            schema_->field(i), ArrayVector()));
+      }
+      *table = std::make_shared<Table>(schema_, columns, 0);
+      return Status::OK();
+    }
+
+    // Put the groups of fields of each batch back together
+    std::vector<std::shared_ptr<RecordBatch>> batches(num_batches);
+    for (int i = 0; i < num_batches; ++i) {
+      if (num_groups == 1) {
+        batches[i] = pieces[i];
+        continue;
+      }
+      std::vector<std::shared_ptr<Array>> columns;
+      for (int group = 0; group < num_groups; ++group) {
+        const RecordBatch& piece = *pieces[i * num_groups + group];
+        for (int j = 0; j < piece.num_columns(); ++j) {
+          columns.push_back(piece.column(j));
+        }
+      }
+      batches[i] = std::make_shared<RecordBatch>(
+          schema_, pieces[i * num_groups]->num_rows(), std::move(columns));
+    }
+    return Table::FromRecordBatches(batches, table);
   }
 
   Status ReadSchema() {
@@ -401,14 +1115,16 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
       // TODO(wesm): ARROW-388 -- the buffer frame of reference is 0 (see
       // ARROW-384).
       std::shared_ptr<Buffer> buffer_block;
-      RETURN_NOT_OK(file_->Read(block.body_length, &buffer_block));
+      RETURN_NOT_OK(file_->ReadAt(
+          block.offset + block.metadata_length, block.body_length, &buffer_block));
       io::BufferReader reader(buffer_block);
 
       std::shared_ptr<Array> dictionary;
       int64_t dictionary_id;
       RETURN_NOT_OK(ReadDictionary(
-          *message, dictionary_fields_, &reader, &dictionary_id, &dictionary));
-      RETURN_NOT_OK(dictionary_memo_->AddDictionary(dictionary_id, dictionary));
+          *message, dictionary_fields_, &reader, pool_, &dictionary_id, &dictionary));
+      RETURN_NOT_OK(AddDictionaryToMemo(dictionary_id, IsDictionaryDelta(*message),
+          dictionary, pool_, dictionary_memo_.get()));
     }
 
     // Get the schema
@@ -440,6 +1156,9 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
 
   // Reconstructed schema, including any read dictionaries
   std::shared_ptr<Schema> schema_;
+
+  // For decompressed buffers and concatenated dictionaries
+  MemoryPool* pool_;
 };
 
 RecordBatchFileReader::RecordBatchFileReader() {
@@ -469,6 +1188,10 @@ int RecordBatchFileReader::num_record_batches() const {
   return impl_->num_record_batches();
 }
 
+void RecordBatchFileReader::set_memory_pool(MemoryPool* pool) {
+  impl_->set_memory_pool(pool);
+}
+
 MetadataVersion RecordBatchFileReader::version() const {
   return impl_->version();
 }
@@ -477,6 +1200,24 @@ Status RecordBatchFileReader::GetRecordBatch(int i, std::shared_ptr<RecordBatch>
   return impl_->GetRecordBatch(i, batch);
 }
 
+Status RecordBatchFileReader::GetRecordBatch(int i,
+    const std::vector<int>& included_fields, std::shared_ptr<RecordBatch>* batch) {
+  return impl_->GetRecordBatch(i, included_fields, batch);
+}
+
+Status RecordBatchFileReader::ReadBatches(const std::vector<int>& indices,
+    int num_threads, std::shared_ptr<Table>* table) {
+  return impl_->ReadBatches(indices, num_threads, table);
+}
+
+Status RecordBatchFileReader::ReadAll(int num_threads, std::shared_ptr<Table>* table) {
+  std::vector<int> indices(impl_->num_record_batches());
+  for (int i = 0; i < static_cast<int>(indices.size()); ++i) {
+    indices[i] = i;
+  }
+  return impl_->ReadBatches(indices, num_threads, table);
+}
+
 static Status ReadContiguousPayload(int64_t offset, io::RandomAccessFile* file,
     std::shared_ptr<Message>* message, std::shared_ptr<Buffer>* payload) {
   std::shared_ptr<Buffer> buffer;
@@ -30,9 +30,11 @@
 namespace arrow {
 
 class Buffer;
+class MemoryPool;
 class RecordBatch;
 class Schema;
 class Status;
+class Table;
 class Tensor;
 
 namespace io {
@@ -74,6 +76,40 @@ class ARROW_EXPORT RecordBatchStreamReader : public RecordBatchReader {
   static Status Open(const std::shared_ptr<io::InputStream>& stream,
       std::shared_ptr<RecordBatchStreamReader>* reader);
 
+  /// Create batch reader that only reads some of the fields. The bytes of the
+  /// other fields are skipped with InputStream::Advance
+  ///
+  /// \param(in) stream an input stream instance
+  /// \param(in) included_fields the indices in the stream schema of the fields
+  /// to read, in the order of the columns of the read batches
+  /// \param(out) reader the created reader object, whose schema has only the
+  /// included fields
+  /// \return Status
+  static Status Open(const std::shared_ptr<io::InputStream>& stream,
+      const std::vector<int>& included_fields,
+      std::shared_ptr<RecordBatchStreamReader>* reader);
+
+  /// Buffers that have to be allocated, such as the decompressed buffers of a
+  /// compressed body, come from the default memory pool unless this is set.
+  /// Applies to the messages read after this call
+  ///
+  /// \param(in) pool the memory pool to allocate the buffers from
+  void set_memory_pool(MemoryPool* pool);
+
+  /// Read the bodies of the record batches that follow into buffers that are
+  /// reused once the batches read into them are released, and message
+  /// metadata into one reused buffer. Reading from a stream that is not
+  /// zero-copy then does not allocate a buffer for each message
+  ///
+  /// Dictionaries and decompressed buffers are still read into new buffers.
+  /// When all the kept body buffers are in use, a body is read into a new
+  /// buffer that is not kept
+  ///
+  /// \param(in) max_buffers the number of body buffers to keep for reuse, 0
+  /// to read each body into a new buffer
+  /// \param(in) pool the memory pool to allocate the buffers from
+  void set_reuse_buffers(int max_buffers, MemoryPool* pool);
+
   std::shared_ptr<Schema> schema() const override;
   Status GetNextRecordBatch(std::shared_ptr<RecordBatch>* batch) override;
 
@@ -116,6 +152,14 @@ class ARROW_EXPORT RecordBatchFileReader {
   /// Returns MetadataVersion in the file metadata
   MetadataVersion version() const;
 
+  /// Buffers that have to be allocated, such as the decompressed buffers of a
+  /// compressed body, come from the default memory pool unless this is set.
+  /// The dictionaries are read when the file is opened, so this applies to the
+  /// record batches only
+  ///
+  /// \param(in) pool the memory pool to allocate the buffers from
+  void set_memory_pool(MemoryPool* pool);
+
   /// Read a record batch from the file. Does not copy memory if the input
   /// source supports zero-copy.
   ///
@@ -124,6 +168,34 @@ class ARROW_EXPORT RecordBatchFileReader {
   /// \return Status
   Status GetRecordBatch(int i, std::shared_ptr<RecordBatch>* batch);
 
+  /// Read some of the fields of a record batch from the file. Only the
+  /// buffers of those fields are read, with RandomAccessFile::ReadRanges
+  ///
+  /// \param(in) i the index of the record batch to return
+  /// \param(in) included_fields the indices in the schema of the fields to
+  /// read, in the order of the columns of the read batch
+  /// \param(out) batch the read batch
+  /// \return Status
+  Status GetRecordBatch(int i, const std::vector<int>& included_fields,
+      std::shared_ptr<RecordBatch>* batch);
+
+  /// Read several record batches into a Table, on up to num_threads threads.
+  /// When there are fewer batches than threads, the fields of each batch are
+  /// split into groups that are read in parallel too. All reads go through
+  /// RandomAccessFile::ReadAt, which leaves the file position alone and may be
+  /// called from several threads
+  ///
+  /// \param(in) indices the indices of the record batches to read, in the
+  /// order of the chunks of the table
+  /// \param(in) num_threads the maximum number of threads to use
+  /// \param(out) table the read table
+  /// \return Status
+  Status ReadBatches(const std::vector<int>& indices, int num_threads,
+      std::shared_ptr<Table>* table);
+
+  /// Read all of the record batches into a Table, as ReadBatches does
+  Status ReadAll(int num_threads, std::shared_ptr<Table>* table);
+
  private:
   RecordBatchFileReader();
 
@@ -22,6 +22,8 @@
 #include <cstring>
 #include <limits>
 #include <sstream>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "arrow/array.h"
@@ -37,6 +39,7 @@
 #include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/util/bit-util.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
@@ -91,11 +94,13 @@ static inline bool NeedTruncate(
 class RecordBatchSerializer : public ArrayVisitor {
  public:
   RecordBatchSerializer(MemoryPool* pool, int64_t buffer_start_offset,
-      int max_recursion_depth, bool allow_64bit)
+      int max_recursion_depth, bool allow_64bit,
+      Compression::type compression = Compression::UNCOMPRESSED)
       : pool_(pool),
         max_recursion_depth_(max_recursion_depth),
         buffer_start_offset_(buffer_start_offset),
-        allow_64bit_(allow_64bit) {
+        allow_64bit_(allow_64bit),
+        compression_(compression) {
     DCHECK_GT(max_recursion_depth, 0);
   }
 
@@ -130,6 +135,7 @@ class RecordBatchSerializer : public ArrayVisitor {
       field_nodes_.clear();
       buffer_meta_.clear();
       buffers_.clear();
+      uncompressed_lengths_.clear();
     }
 
     // Perform depth-first traversal of the row-batch
@@ -137,6 +143,8 @@ class RecordBatchSerializer : public ArrayVisitor {
       RETURN_NOT_OK(VisitArray(*batch.column(i)));
     }
 
+    if (compression_ != Compression::UNCOMPRESSED) { RETURN_NOT_OK(CompressBuffers()); }
+
     // The position for the start of a buffer relative to the passed frame of
     // reference. May be 0 or some other position in an address space
     int64_t offset = buffer_start_offset_;
@@ -165,7 +173,11 @@ class RecordBatchSerializer : public ArrayVisitor {
       // are using from any OS-level shared memory. The thought is that systems
       // may (in the future) associate integer page id's with physical memory
       // pages (according to whatever is the desired shared memory mechanism)
-      buffer_meta_.push_back({kNoPageId, offset, size + padding});
+      //
+      // A compressed buffer must be given to the codec without its padding
+      const int64_t length =
+          compression_ == Compression::UNCOMPRESSED ? size + padding : size;
+      buffer_meta_.push_back({kNoPageId, offset, length});
       offset += size + padding;
     }
 
@@ -178,8 +190,8 @@ class RecordBatchSerializer : public ArrayVisitor {
   // Override this for writing dictionary metadata
   virtual Status WriteMetadataMessage(
       int64_t num_rows, int64_t body_length, std::shared_ptr<Buffer>* out) {
-    return WriteRecordBatchMessage(
-        num_rows, body_length, field_nodes_, buffer_meta_, out);
+    return WriteRecordBatchMessage(num_rows, body_length, field_nodes_, buffer_meta_,
+        compression_, uncompressed_lengths_, out);
   }
 
   Status Write(const RecordBatch& batch, io::OutputStream* dst, int32_t* metadata_length,
@@ -205,9 +217,11 @@ class RecordBatchSerializer : public ArrayVisitor {
     DCHECK(BitUtil::IsMultipleOf8(current_position));
 #endif
 
-    // Now write the buffers
+    // Now write the buffers and their padding as one gathered write
+    std::vector<std::shared_ptr<Buffer>> body;
+    body.reserve(2 * buffers_.size());
     for (size_t i = 0; i < buffers_.size(); ++i) {
-      const Buffer* buffer = buffers_[i].get();
+      const std::shared_ptr<Buffer>& buffer = buffers_[i];
       int64_t size = 0;
       int64_t padding = 0;
 
@@ -217,10 +231,13 @@ class RecordBatchSerializer : public ArrayVisitor {
         padding = BitUtil::RoundUpToMultipleOf64(size) - size;
       }
 
-      if (size > 0) { RETURN_NOT_OK(dst->Write(buffer->data(), size)); }
+      if (size > 0) { body.push_back(buffer); }
 
-      if (padding > 0) { RETURN_NOT_OK(dst->Write(kPaddingBytes, padding)); }
+      if (padding > 0) {
+        body.push_back(std::make_shared<Buffer>(kPaddingBytes, padding));
+      }
     }
+    RETURN_NOT_OK(dst->Writev(body));
 
 #ifndef NDEBUG
     RETURN_NOT_OK(dst->Tell(&current_position));
@@ -231,6 +248,31 @@ class RecordBatchSerializer : public ArrayVisitor {
   }
 
  protected:
+  // Replace each buffer with its compressed form, remembering its length
+  Status CompressBuffers() {
+    std::unique_ptr<Codec> codec;
+    RETURN_NOT_OK(Codec::Create(compression_, &codec));
+    if (!codec) { return Status::Invalid("Compressing the body requires a codec"); }
+
+    uncompressed_lengths_.resize(buffers_.size());
+    for (size_t i = 0; i < buffers_.size(); ++i) {
+      const Buffer* buffer = buffers_[i].get();
+      const int64_t size = buffer ? buffer->size() : 0;
+      uncompressed_lengths_[i] = size;
+      if (size == 0) { continue; }
+
+      const int64_t max_length = codec->MaxCompressedLen(size, buffer->data());
+      std::shared_ptr<ResizableBuffer> compressed;
+      RETURN_NOT_OK(AllocateResizableBuffer(pool_, max_length, &compressed));
+      int64_t compressed_length;
+      RETURN_NOT_OK(codec->Compress(size, buffer->data(), max_length,
+          compressed->mutable_data(), &compressed_length));
+      RETURN_NOT_OK(compressed->Resize(compressed_length));
+      buffers_[i] = compressed;
+    }
+    return Status::OK();
+  }
+
   template <typename ArrayType>
   Status VisitFixedWidth(const ArrayType& array) {
     std::shared_ptr<Buffer> data = array.data();
@@ -478,6 +520,10 @@ class RecordBatchSerializer : public ArrayVisitor {
   int64_t max_recursion_depth_;
   int64_t buffer_start_offset_;
   bool allow_64bit_;
+
+  // With a codec, the length of each buffer in buffers_ before compression
+  Compression::type compression_;
+  std::vector<int64_t> uncompressed_lengths_;
 };
 
 class DictionaryWriter : public RecordBatchSerializer {
@@ -486,13 +532,15 @@ class DictionaryWriter : public RecordBatchSerializer {
 
   Status WriteMetadataMessage(
       int64_t num_rows, int64_t body_length, std::shared_ptr<Buffer>* out) override {
-    return WriteDictionaryMessage(
-        dictionary_id_, num_rows, body_length, field_nodes_, buffer_meta_, out);
+    return WriteDictionaryMessage(dictionary_id_, is_delta_, num_rows, body_length,
+        field_nodes_, buffer_meta_, compression_, uncompressed_lengths_, out);
   }
 
-  Status Write(int64_t dictionary_id, const std::shared_ptr<Array>& dictionary,
-      io::OutputStream* dst, int32_t* metadata_length, int64_t* body_length) {
+  Status Write(int64_t dictionary_id, bool is_delta,
+      const std::shared_ptr<Array>& dictionary, io::OutputStream* dst,
+      int32_t* metadata_length, int64_t* body_length) {
     dictionary_id_ = dictionary_id;
+    is_delta_ = is_delta;
 
     // Make a dummy record batch. A bit tedious as we have to make a schema
     std::vector<std::shared_ptr<Field>> fields = {
@@ -506,6 +554,7 @@ class DictionaryWriter : public RecordBatchSerializer {
  private:
   // TODO(wesm): Setting this in Write is a bit unclean, but it works
   int64_t dictionary_id_;
+  bool is_delta_;
 };
 
 // Adds padding bytes if necessary to ensure all memory blocks are written on
@@ -520,9 +569,10 @@ Status AlignStreamPosition(io::OutputStream* stream) {
 
 Status WriteRecordBatch(const RecordBatch& batch, int64_t buffer_start_offset,
     io::OutputStream* dst, int32_t* metadata_length, int64_t* body_length,
-    MemoryPool* pool, int max_recursion_depth, bool allow_64bit) {
+    MemoryPool* pool, int max_recursion_depth, bool allow_64bit,
+    Compression::type compression) {
   RecordBatchSerializer writer(
-      pool, buffer_start_offset, max_recursion_depth, allow_64bit);
+      pool, buffer_start_offset, max_recursion_depth, allow_64bit, compression);
   return writer.Write(batch, dst, metadata_length, body_length);
 }
 
@@ -555,9 +605,12 @@ Status WriteTensor(const Tensor& tensor, io::OutputStream* dst, int32_t* metadat
 
 Status WriteDictionary(int64_t dictionary_id, const std::shared_ptr<Array>& dictionary,
     int64_t buffer_start_offset, io::OutputStream* dst, int32_t* metadata_length,
-    int64_t* body_length, MemoryPool* pool) {
-  DictionaryWriter writer(pool, buffer_start_offset, kMaxNestingDepth, false);
-  return writer.Write(dictionary_id, dictionary, dst, metadata_length, body_length);
+    int64_t* body_length, MemoryPool* pool, Compression::type compression,
+    bool is_delta) {
+  DictionaryWriter writer(
+      pool, buffer_start_offset, kMaxNestingDepth, false, compression);
+  return writer.Write(
+      dictionary_id, is_delta, dictionary, dst, metadata_length, body_length);
 }
 
 Status GetRecordBatchSize(const RecordBatch& batch, int64_t* size) {
@@ -585,13 +638,18 @@ Status GetTensorSize(const Tensor& tensor, int64_t* size) {
 
 RecordBatchWriter::~RecordBatchWriter() {}
 
+void RecordBatchWriter::set_compression(Compression::type compression) {}
+
 // ----------------------------------------------------------------------
 // Stream writer implementation
 
 class RecordBatchStreamWriter::RecordBatchStreamWriterImpl {
  public:
   RecordBatchStreamWriterImpl()
-      : pool_(default_memory_pool()), position_(-1), started_(false) {}
+      : pool_(default_memory_pool()),
+        compression_(Compression::UNCOMPRESSED),
+        position_(-1),
+        started_(false) {}
 
   virtual ~RecordBatchStreamWriterImpl() = default;
 
@@ -637,30 +695,120 @@ class RecordBatchStreamWriter::RecordBatchStreamWriterImpl {
   Status UpdatePosition() { return sink_->Tell(&position_); }
 
   Status WriteDictionaries() {
-    const DictionaryMap& id_to_dictionary = dictionary_memo_.id_to_dictionary();
+    // TODO(wesm): does sorting by id yield any benefit?
+    for (const auto& entry : dictionary_memo_.id_to_dictionary()) {
+      RETURN_NOT_OK(WriteDictionary(entry.first, entry.second, false));
+    }
+    return Status::OK();
+  }
 
-    dictionaries_.resize(id_to_dictionary.size());
+  Status WriteDictionary(
+      int64_t id, const std::shared_ptr<Array>& dictionary, bool is_delta) {
+    dictionaries_.emplace_back(0, 0, 0);
+    FileBlock* block = &dictionaries_[dictionaries_.size() - 1];
 
-    // TODO(wesm): does sorting by id yield any benefit?
-    int dict_index = 0;
-    for (const auto& entry : id_to_dictionary) {
-      FileBlock* block = &dictionaries_[dict_index++];
-
-      block->offset = position_;
-
-      // Frame of reference in file format is 0, see ARROW-384
-      const int64_t buffer_start_offset = 0;
-      RETURN_NOT_OK(WriteDictionary(entry.first, entry.second, buffer_start_offset, sink_,
-          &block->metadata_length, &block->body_length, pool_));
-      RETURN_NOT_OK(UpdatePosition());
-      DCHECK(position_ % 8 == 0) << "WriteDictionary did not perform aligned writes";
+    block->offset = position_;
+
+    // Frame of reference in file format is 0, see ARROW-384
+    const int64_t buffer_start_offset = 0;
+    RETURN_NOT_OK(arrow::ipc::WriteDictionary(id, dictionary, buffer_start_offset, sink_,
+        &block->metadata_length, &block->body_length, pool_, compression_, is_delta));
+    RETURN_NOT_OK(UpdatePosition());
+    DCHECK(position_ % 8 == 0) << "WriteDictionary did not perform aligned writes";
+    return Status::OK();
+  }
+
+  // Whether a dictionary may be sent again in full, replacing the previous one
+  virtual bool AllowDictionaryReplacement() const { return true; }
+
+  // Add each dictionary-encoded field of the batch type to dictionaries, with
+  // the id of the dictionary of the same field in the schema
+  Status CollectDictionaries(const DataType& schema_type, const DataType& batch_type,
+      std::vector<std::pair<int64_t, std::shared_ptr<Array>>>* dictionaries) {
+    if (schema_type.id() != batch_type.id() ||
+        schema_type.num_children() != batch_type.num_children()) {
+      return Status::Invalid("Record batch fields do not match the schema");
+    }
+    if (schema_type.id() == Type::DICTIONARY) {
+      const auto& schema_dict = static_cast<const DictionaryType&>(schema_type);
+      const auto& batch_dict = static_cast<const DictionaryType&>(batch_type);
+      // The indices are read with the index type in the schema
+      if (!schema_dict.index_type()->Equals(batch_dict.index_type())) {
+        return Status::Invalid("Dictionary index type does not match the schema");
+      }
+      dictionaries->emplace_back(
+          dictionary_memo_.GetId(schema_dict.dictionary()), batch_dict.dictionary());
+      return Status::OK();
+    }
+    for (int i = 0; i < schema_type.num_children(); ++i) {
+      RETURN_NOT_OK(CollectDictionaries(*schema_type.children()[i]->type(),
+          *batch_type.children()[i]->type(), dictionaries));
     }
+    return Status::OK();
+  }
 
+  // Before a record batch whose dictionaries differ from the ones last sent,
+  // send the new entries as a delta when the previous dictionary is a prefix
+  // of the new one (as with the output of a DictionaryBuilder reused across
+  // batches), and the whole dictionary otherwise
+  Status WriteDictionaryUpdates(const RecordBatch& batch) {
+    if (dictionary_memo_.size() == 0) { return Status::OK(); }
+    if (batch.num_columns() != schema_->num_fields()) {
+      return Status::Invalid("Record batch fields do not match the schema");
+    }
+
+    std::vector<std::pair<int64_t, std::shared_ptr<Array>>> dictionaries;
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      RETURN_NOT_OK(CollectDictionaries(
+          *schema_->field(i)->type(), *batch.column(i)->type(), &dictionaries));
+    }
+
+    // Fields sharing a dictionary id must share the dictionary in a batch
+    std::unordered_map<int64_t, std::shared_ptr<Array>> batch_dictionaries;
+    for (const auto& entry : dictionaries) {
+      const int64_t id = entry.first;
+      const std::shared_ptr<Array>& dictionary = entry.second;
+
+      auto it = batch_dictionaries.find(id);
+      if (it != batch_dictionaries.end()) {
+        if (it->second != dictionary && !it->second->Equals(dictionary)) {
+          std::stringstream ss;
+          ss << "Fields with dictionary id " << id
+             << " have different dictionaries in the record batch";
+          return Status::Invalid(ss.str());
+        }
+        continue;
+      }
+      batch_dictionaries[id] = dictionary;
+
+      std::shared_ptr<Array> previous;
+      RETURN_NOT_OK(dictionary_memo_.GetDictionary(id, &previous));
+      if (dictionary == previous) { continue; }
+      if (!dictionary->type()->Equals(previous->type())) {
+        return Status::Invalid("Dictionary type does not match the schema");
+      }
+
+      const int64_t previous_length = previous->length();
+      const bool extends_previous =
+          dictionary->length() >= previous_length &&
+          dictionary->RangeEquals(0, previous_length, 0, previous);
+      if (!extends_previous) {
+        if (!AllowDictionaryReplacement()) {
+          return Status::Invalid(
+              "Dictionaries can only be extended, not replaced, in this format");
+        }
+        RETURN_NOT_OK(WriteDictionary(id, dictionary, false));
+      } else if (dictionary->length() > previous_length) {
+        RETURN_NOT_OK(WriteDictionary(id, dictionary->Slice(previous_length), true));
+      }
+      RETURN_NOT_OK(dictionary_memo_.UpdateDictionary(id, dictionary));
+    }
     return Status::OK();
   }
 
   Status WriteRecordBatch(const RecordBatch& batch, bool allow_64bit, FileBlock* block) {
     RETURN_NOT_OK(CheckStarted());
+    RETURN_NOT_OK(WriteDictionaryUpdates(batch));
 
     block->offset = position_;
 
@@ -668,7 +816,7 @@ class RecordBatchStreamWriter::RecordBatchStreamWriterImpl {
     const int64_t buffer_start_offset = 0;
     RETURN_NOT_OK(arrow::ipc::WriteRecordBatch(batch, buffer_start_offset, sink_,
         &block->metadata_length, &block->body_length, pool_, kMaxNestingDepth,
-        allow_64bit));
+        allow_64bit, compression_));
     RETURN_NOT_OK(UpdatePosition());
 
     DCHECK(position_ % 8 == 0) << "WriteRecordBatch did not perform aligned writes";
@@ -700,6 +848,8 @@ class RecordBatchStreamWriter::RecordBatchStreamWriterImpl {
 
   void set_memory_pool(MemoryPool* pool) { pool_ = pool; }
 
+  void set_compression(Compression::type compression) { compression_ = compression; }
+
  protected:
   io::OutputStream* sink_;
   std::shared_ptr<Schema> schema_;
@@ -709,6 +859,7 @@ class RecordBatchStreamWriter::RecordBatchStreamWriterImpl {
   DictionaryMemo dictionary_memo_;
 
   MemoryPool* pool_;
+  Compression::type compression_;
 
   int64_t position_;
   bool started_;
@@ -732,6 +883,10 @@ void RecordBatchStreamWriter::set_memory_pool(MemoryPool* pool) {
   impl_->set_memory_pool(pool);
 }
 
+void RecordBatchStreamWriter::set_compression(Compression::type compression) {
+  impl_->set_compression(compression);
+}
+
 Status RecordBatchStreamWriter::Open(io::OutputStream* sink,
     const std::shared_ptr<Schema>& schema,
     std::shared_ptr<RecordBatchStreamWriter>* out) {
@@ -763,6 +918,10 @@ class RecordBatchFileWriter::RecordBatchFileWriterImpl
     return BASE::Start();
   }
 
+  // The file reader loads all dictionaries before any record batch, so a
+  // dictionary can only grow with deltas that keep earlier indices valid
+  bool AllowDictionaryReplacement() const override { return false; }
+
   Status Close() override {
     // Write metadata
     int64_t initial_position = position_;
@@ -806,5 +965,9 @@ Status RecordBatchFileWriter::Close() {
   return impl_->Close();
 }
 
+void RecordBatchFileWriter::set_compression(Compression::type compression) {
+  impl_->set_compression(compression);
+}
+
 }  // namespace ipc
 }  // namespace arrow
@@ -68,6 +68,14 @@ class ARROW_EXPORT RecordBatchWriter {
   ///
   /// \param pool the memory pool to use for required allocations
   virtual void set_memory_pool(MemoryPool* pool) = 0;
+
+  /// Compress each buffer of the record batches and dictionaries written
+  /// after this call with the codec. Readers decompress them transparently.
+  /// Off (UNCOMPRESSED) by default. Writers that do not support compression
+  /// ignore this
+  ///
+  /// \param compression the codec to compress the buffers with
+  virtual void set_compression(Compression::type compression);
 };
 
 /// \class RecordBatchStreamWriter
@@ -90,6 +98,7 @@ class ARROW_EXPORT RecordBatchStreamWriter : public RecordBatchWriter {
   Status WriteRecordBatch(const RecordBatch& batch, bool allow_64bit = false) override;
   Status Close() override;
   void set_memory_pool(MemoryPool* pool) override;
+  void set_compression(Compression::type compression) override;
 
  protected:
   RecordBatchStreamWriter();
@@ -117,6 +126,7 @@ class ARROW_EXPORT RecordBatchFileWriter : public RecordBatchStreamWriter {
 
   Status WriteRecordBatch(const RecordBatch& batch, bool allow_64bit = false) override;
   Status Close() override;
+  void set_compression(Compression::type compression) override;
 
  private:
   RecordBatchFileWriter();
@@ -140,6 +150,7 @@ class ARROW_EXPORT RecordBatchFileWriter : public RecordBatchStreamWriter {
 /// default should be 0
 /// \param(in) allow_64bit permit field lengths exceeding INT32_MAX. May not be
 /// readable by other Arrow implementations
+/// \param(in) compression the codec to compress each buffer with, if any
 /// \param(out) metadata_length: the size of the length-prefixed flatbuffer
 /// including padding to a 64-byte boundary
 /// \param(out) body_length: the size of the contiguous buffer block plus
@@ -147,12 +158,14 @@ class ARROW_EXPORT RecordBatchFileWriter : public RecordBatchStreamWriter {
 Status ARROW_EXPORT WriteRecordBatch(const RecordBatch& batch,
     int64_t buffer_start_offset, io::OutputStream* dst, int32_t* metadata_length,
     int64_t* body_length, MemoryPool* pool, int max_recursion_depth = kMaxNestingDepth,
-    bool allow_64bit = false);
+    bool allow_64bit = false, Compression::type compression = Compression::UNCOMPRESSED);
 
-// Write Array as a DictionaryBatch message
+// Write Array as a DictionaryBatch message. A delta is appended by readers
+// to the dictionary with the same id
 Status WriteDictionary(int64_t dictionary_id, const std::shared_ptr<Array>& dictionary,
     int64_t buffer_start_offset, io::OutputStream* dst, int32_t* metadata_length,
-    int64_t* body_length, MemoryPool* pool);
+    int64_t* body_length, MemoryPool* pool,
+    Compression::type compression = Compression::UNCOMPRESSED, bool is_delta = false);
 
 // Compute the precise number of bytes needed in a contiguous memory segment to
 // write the record batch. This involves generating the complete serialized
@@ -246,6 +246,79 @@ Status LoadArray(const std::shared_ptr<DataType>& type, ArrayLoaderContext* cont
   return Status::OK();
 }
 
+// Counts the field nodes and buffers ArrayLoader would consume for a type
+class ArraySkipper {
+ public:
+  explicit ArraySkipper(ArrayLoaderContext* context) : context_(context) {}
+
+  Status Skip(const DataType& type) {
+    if (context_->max_recursion_depth <= 0) {
+      return Status::Invalid("Max recursion depth reached");
+    }
+    return VisitTypeInline(type, this);
+  }
+
+  Status Visit(const NullType& type) { return Status::NotImplemented("null"); }
+
+  Status Visit(const DecimalType& type) { return Status::NotImplemented("decimal"); }
+
+  template <typename T>
+  typename std::enable_if<std::is_base_of<FixedWidthType, T>::value &&
+                              !std::is_base_of<DictionaryType, T>::value,
+      Status>::type
+  Visit(const T& type) {
+    // Validity bitmap and data
+    return SkipNode(2);
+  }
+
+  template <typename T>
+  typename std::enable_if<std::is_base_of<BinaryType, T>::value, Status>::type Visit(
+      const T& type) {
+    // Validity bitmap, offsets and data
+    return SkipNode(3);
+  }
+
+  Status Visit(const ListType& type) {
+    RETURN_NOT_OK(SkipNode(2));
+    return SkipChildren(type.children());
+  }
+
+  Status Visit(const StructType& type) {
+    RETURN_NOT_OK(SkipNode(1));
+    return SkipChildren(type.children());
+  }
+
+  Status Visit(const UnionType& type) {
+    RETURN_NOT_OK(SkipNode(type.mode() == UnionMode::DENSE ? 3 : 2));
+    return SkipChildren(type.children());
+  }
+
+  Status Visit(const DictionaryType& type) { return Skip(*type.index_type()); }
+
+ private:
+  Status SkipNode(int num_buffers) {
+    ++context_->field_index;
+    context_->buffer_index += num_buffers;
+    return Status::OK();
+  }
+
+  Status SkipChildren(const std::vector<std::shared_ptr<Field>>& child_fields) {
+    --context_->max_recursion_depth;
+    for (const auto& child_field : child_fields) {
+      RETURN_NOT_OK(Skip(*child_field->type()));
+    }
+    ++context_->max_recursion_depth;
+    return Status::OK();
+  }
+
+  ArrayLoaderContext* context_;
+};
+
+Status SkipArray(const std::shared_ptr<DataType>& type, ArrayLoaderContext* context) {
+  ArraySkipper skipper(context);
+  return skipper.Skip(*type);
+}
+
 class InMemorySource : public ArrayComponentSource {
  public:
   InMemorySource(const std::vector<FieldMetadata>& fields,
@@ -105,6 +105,16 @@ Status ARROW_EXPORT LoadArray(const std::shared_ptr<DataType>& type,
 Status ARROW_EXPORT LoadArray(const std::shared_ptr<DataType>& field,
     ArrayLoaderContext* context, std::shared_ptr<Array>* out);
 
+/// Advance the field_index and buffer_index of the context past the
+/// components of an array of the given type, without reading them. Used to
+/// load only some of the arrays stored one after another in a source
+///
+/// \param[in] type the data type of the array being skipped
+/// \param[in,out] context the context positioned at the start of the array
+/// \return Status indicating success or failure
+Status ARROW_EXPORT SkipArray(
+    const std::shared_ptr<DataType>& type, ArrayLoaderContext* context);
+
 Status ARROW_EXPORT LoadArray(const std::shared_ptr<DataType>& type,
     const std::vector<FieldMetadata>& fields,
     const std::vector<std::shared_ptr<Buffer>>& buffers, std::shared_ptr<Array>* out);
@@ -0,0 +1,174 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/memory_pool.h"
+#include "arrow/table.h"
+#include "arrow/test-util.h"
+
+namespace arrow {
+
+static ThreadCachingMemoryPool* thread_caching_pool() {
+  static ThreadCachingMemoryPool pool;
+  return &pool;
+}
+
+// Allocate and free blocks of a few small sizes, as builders do while growing
+static void AllocateFreeLoop(MemoryPool* pool, benchmark::State& state) {
+  const int64_t sizes[] = {64, 256, 1024, 4096, 16384};
+  uint8_t* data[5];
+  while (state.KeepRunning()) {
+    for (int i = 0; i < 5; ++i) {
+      ABORT_NOT_OK(pool->Allocate(sizes[i], &data[i]));
+    }
+    for (int i = 0; i < 5; ++i) {
+      pool->Free(data[i], sizes[i]);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * 5);
+}
+
+static void BM_AllocateFreeDefault(
+    benchmark::State& state) {  // NOLINT non-const reference
+  AllocateFreeLoop(default_memory_pool(), state);
+}
+
+static void BM_AllocateFreeThreadCaching(
+    benchmark::State& state) {  // NOLINT non-const reference
+  AllocateFreeLoop(thread_caching_pool(), state);
+}
+
+// Every thread builds its own small arrays from the shared pool
+static void BuildArraysLoop(MemoryPool* pool, benchmark::State& state) {
+  const int64_t length = 1000;
+  while (state.KeepRunning()) {
+    Int64Builder builder(pool);
+    for (int64_t i = 0; i < length; ++i) {
+      ABORT_NOT_OK(builder.Append(i));
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * length * sizeof(int64_t));
+}
+
+static void BM_BuildInt64Default(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BuildArraysLoop(default_memory_pool(), state);
+}
+
+static void BM_BuildInt64ThreadCaching(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BuildArraysLoop(thread_caching_pool(), state);
+}
+
+// Build a small record batch of an integer, a double and a string column
+static void BuildSmallRecordBatch(MemoryPool* pool, int64_t length) {
+  Int64Builder ints(pool);
+  DoubleBuilder doubles(pool);
+  StringBuilder strings(pool);
+  for (int64_t i = 0; i < length; ++i) {
+    ABORT_NOT_OK(ints.Append(i));
+    ABORT_NOT_OK(doubles.Append(static_cast<double>(i) / 3));
+    ABORT_NOT_OK(strings.Append("value"));
+  }
+  std::vector<std::shared_ptr<Array>> columns(3);
+  ABORT_NOT_OK(ints.Finish(&columns[0]));
+  ABORT_NOT_OK(doubles.Finish(&columns[1]));
+  ABORT_NOT_OK(strings.Finish(&columns[2]));
+
+  auto schema = std::make_shared<Schema>(std::vector<std::shared_ptr<Field>>(
+      {field("i", int64()), field("d", float64()), field("s", utf8())}));
+  RecordBatch batch(schema, length, columns);
+  benchmark::DoNotOptimize(batch.num_rows());
+}
+
+static void BM_BuildSmallBatchesDefault(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t length = state.range(0);
+  while (state.KeepRunning()) {
+    BuildSmallRecordBatch(default_memory_pool(), length);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_BuildSmallBatchesArena(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t length = state.range(0);
+  ArenaMemoryPool arena(default_memory_pool());
+  while (state.KeepRunning()) {
+    BuildSmallRecordBatch(&arena, length);
+    arena.Reset();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Sum a 256 MB Int64Array whose data buffer was allocated from the given pool
+static void ScanLargeArray(MemoryPool* pool, benchmark::State& state) {
+  const int64_t length = 32 * 1024 * 1024;
+  std::shared_ptr<MutableBuffer> data;
+  ABORT_NOT_OK(AllocateBuffer(pool, length * sizeof(int64_t), &data));
+  auto values = reinterpret_cast<int64_t*>(data->mutable_data());
+  for (int64_t i = 0; i < length; ++i) {
+    values[i] = i;
+  }
+  Int64Array array(length, data);
+
+  // Touch the values in a strided order to defeat the hardware prefetcher
+  const int64_t stride = 4099;
+  while (state.KeepRunning()) {
+    int64_t total = 0;
+    for (int64_t i = 0, j = 0; i < length; ++i, j = (j + stride) % length) {
+      total += array.Value(j);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetBytesProcessed(state.iterations() * length * sizeof(int64_t));
+}
+
+static void BM_ScanLargeArrayDefault(
+    benchmark::State& state) {  // NOLINT non-const reference
+  ScanLargeArray(default_memory_pool(), state);
+}
+
+static void BM_ScanLargeArrayHugePages(
+    benchmark::State& state) {  // NOLINT non-const reference
+  HugePageMemoryPool pool;
+  ScanLargeArray(&pool, state);
+}
+
+static void BM_ScanLargeArrayHugePagesNumaNode0(
+    benchmark::State& state) {  // NOLINT non-const reference
+  HugePageMemoryPool pool(0);
+  ScanLargeArray(&pool, state);
+}
+
+BENCHMARK(BM_AllocateFreeDefault)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_AllocateFreeThreadCaching)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_BuildInt64Default)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_BuildInt64ThreadCaching)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_BuildSmallBatchesDefault)->Arg(16)->Arg(256)->Arg(4096);
+BENCHMARK(BM_BuildSmallBatchesArena)->Arg(16)->Arg(256)->Arg(4096);
+BENCHMARK(BM_ScanLargeArrayDefault)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ScanLargeArrayHugePages)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ScanLargeArrayHugePagesNumaNode0)->Unit(benchmark::kMillisecond);
+
+}  // namespace arrow
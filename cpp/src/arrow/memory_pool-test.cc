@@ -19,6 +19,11 @@
 
 #include <cstdint>
 #include <limits>
+#include <thread>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
 
 namespace arrow {
 
@@ -41,6 +46,32 @@ TEST_F(TestDefaultMemoryPool, Reallocate) {
   this->TestReallocate();
 }
 
+TEST_F(TestDefaultMemoryPool, ReallocateLarge) {
+  auto pool = memory_pool();
+  const int64_t size = 8 << 20;
+
+  uint8_t* data;
+  ASSERT_OK(pool->Allocate(size, &data));
+  for (int64_t i = 0; i < size; i += 4096) {
+    data[i] = static_cast<uint8_t>(i / 4096);
+  }
+
+  ASSERT_OK(pool->Reallocate(size, 4 * size, &data));
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data) % 64);
+  data[4 * size - 1] = 1;
+  ASSERT_OK(pool->Reallocate(4 * size, size + 1, &data));
+  for (int64_t i = 0; i < size; i += 4096) {
+    ASSERT_EQ(static_cast<uint8_t>(i / 4096), data[i]);
+  }
+
+  // Crossing back below the threshold for mapped allocations
+  data[4095] = 1;
+  ASSERT_OK(pool->Reallocate(size + 1, 4096, &data));
+  ASSERT_EQ(1, data[4095]);
+  pool->Free(data, 4096);
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+
 // Death tests and valgrind are known to not play well 100% of the time. See
 // googletest documentation
 #if !(defined(ARROW_VALGRIND) || defined(ADDRESS_SANITIZER))
@@ -59,6 +90,24 @@ TEST(DefaultMemoryPoolDeathTest, FreeLargeMemory) {
   pool->Free(data, 100);
 }
 
+#if defined(__linux__) && !defined(ARROW_JEMALLOC)
+TEST(DefaultMemoryPoolDeathTest, FreeMappedMemoryWrongSize) {
+  MemoryPool* pool = default_memory_pool();
+  const int64_t size = 8 << 20;
+
+  uint8_t* data;
+  ASSERT_OK(pool->Allocate(size, &data));
+
+#ifndef NDEBUG
+  // Still released as a mapping, even below the mapping threshold
+  EXPECT_EXIT(pool->Free(data, 100), ::testing::ExitedWithCode(1),
+      ".*Check failed: \\(mapped_size\\) == \\(size\\)");
+#endif
+
+  pool->Free(data, size);
+}
+#endif
+
 TEST(DefaultMemoryPoolDeathTest, MaxMemory) {
   DefaultMemoryPool pool;
 
@@ -78,6 +127,442 @@ TEST(DefaultMemoryPoolDeathTest, MaxMemory) {
 
 #endif  // ARROW_VALGRIND
 
+class TestProxyMemoryPool : public ::arrow::test::TestMemoryPoolBase {
+ public:
+  TestProxyMemoryPool() : pool_(&parent_) {}
+
+  ::arrow::MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  DefaultMemoryPool parent_;
+  ProxyMemoryPool pool_;
+};
+
+TEST_F(TestProxyMemoryPool, MemoryTracking) {
+  this->TestMemoryTracking();
+}
+
+TEST_F(TestProxyMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+  ASSERT_EQ(0, pool_.bytes_allocated());
+}
+
+TEST_F(TestProxyMemoryPool, Reallocate) {
+  this->TestReallocate();
+}
+
+TEST(ProxyMemoryPool, Limits) {
+  DefaultMemoryPool root;
+  ProxyMemoryPool process(&root, 1000);
+  ProxyMemoryPool query1(&process, 600);
+  ProxyMemoryPool query2(&process);
+
+  uint8_t* data1;
+  ASSERT_OK(query1.Allocate(500, &data1));
+  ASSERT_RAISES(OutOfMemory, query1.Reallocate(500, 700, &data1));
+  ASSERT_EQ(1, query1.num_rejected());
+  ASSERT_EQ(500, root.bytes_allocated());
+
+  // Rejected by the shared parent
+  uint8_t* data2;
+  ASSERT_RAISES(OutOfMemory, query2.Allocate(600, &data2));
+  ASSERT_EQ(0, query2.bytes_allocated());
+  ASSERT_EQ(1, process.num_rejected());
+  ASSERT_OK(query2.Allocate(400, &data2));
+  ASSERT_EQ(900, process.bytes_allocated());
+
+  query1.Free(data1, 500);
+  query2.Free(data2, 400);
+
+  ASSERT_EQ(0, process.bytes_allocated());
+  ASSERT_EQ(0, root.bytes_allocated());
+  ASSERT_EQ(500, query1.max_memory());
+  ASSERT_EQ(400, query2.max_memory());
+  ASSERT_EQ(900, process.max_memory());
+  ASSERT_EQ(-1, query2.limit());
+}
+
+class TestHugePageMemoryPool : public ::arrow::test::TestMemoryPoolBase {
+ public:
+  ::arrow::MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  HugePageMemoryPool pool_;
+};
+
+TEST_F(TestHugePageMemoryPool, MemoryTracking) {
+  this->TestMemoryTracking();
+}
+
+TEST_F(TestHugePageMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestHugePageMemoryPool, Reallocate) {
+  this->TestReallocate();
+}
+
+TEST_F(TestHugePageMemoryPool, LargeAllocations) {
+  const int64_t huge_page = HugePageMemoryPool::kHugePageSize;
+
+  uint8_t* data;
+  ASSERT_OK(pool_.Allocate(1000, &data));
+  data[999] = 1;
+
+  // Small to large
+  ASSERT_OK(pool_.Reallocate(1000, huge_page + 1, &data));
+#ifdef __linux__
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data) % huge_page);
+#endif
+  ASSERT_EQ(1, data[999]);
+  data[huge_page] = 2;
+
+  // Within the same mapping
+  uint8_t* old_data = data;
+  ASSERT_OK(pool_.Reallocate(huge_page + 1, 2 * huge_page, &data));
+  ASSERT_EQ(old_data, data);
+  data[2 * huge_page - 1] = 3;
+
+  ASSERT_OK(pool_.Reallocate(2 * huge_page, 3 * huge_page, &data));
+  ASSERT_EQ(1, data[999]);
+  ASSERT_EQ(2, data[huge_page]);
+  ASSERT_EQ(3, data[2 * huge_page - 1]);
+  ASSERT_EQ(3 * huge_page, pool_.bytes_allocated());
+
+  // Large to small
+  ASSERT_OK(pool_.Reallocate(3 * huge_page, 1000, &data));
+  ASSERT_EQ(1, data[999]);
+  pool_.Free(data, 1000);
+
+  ASSERT_EQ(0, pool_.bytes_allocated());
+  ASSERT_EQ(3 * huge_page, pool_.max_memory());
+}
+
+TEST(HugePageMemoryPool, NumaNode) {
+  HugePageMemoryPool pool(0);
+  ASSERT_EQ(0, pool.numa_node());
+
+  const int64_t size = 4 * HugePageMemoryPool::kHugePageSize;
+  uint8_t* data;
+  ASSERT_OK(pool.Allocate(size, &data));
+  memset(data, 0xff, size);
+  pool.Free(data, size);
+}
+
+class TestThreadCachingMemoryPool : public ::arrow::test::TestMemoryPoolBase {
+ public:
+  ::arrow::MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  ThreadCachingMemoryPool pool_;
+};
+
+TEST_F(TestThreadCachingMemoryPool, MemoryTracking) {
+  this->TestMemoryTracking();
+}
+
+TEST_F(TestThreadCachingMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestThreadCachingMemoryPool, Reallocate) {
+  this->TestReallocate();
+}
+
+TEST_F(TestThreadCachingMemoryPool, ReuseFreedBlocks) {
+  uint8_t* data;
+  ASSERT_OK(pool_.Allocate(1000, &data));
+  uint8_t* first = data;
+  pool_.Free(data, 1000);
+
+  // Same size class is served from the thread's free list
+  ASSERT_OK(pool_.Allocate(1024, &data));
+  ASSERT_EQ(first, data);
+  ASSERT_EQ(1024, pool_.bytes_allocated());
+
+  // Shrinking or growing within the size class does not move the block
+  ASSERT_OK(pool_.Reallocate(1024, 600, &data));
+  ASSERT_EQ(first, data);
+  ASSERT_EQ(600, pool_.bytes_allocated());
+  ASSERT_OK(pool_.Reallocate(600, 1000, &data));
+  ASSERT_EQ(first, data);
+  ASSERT_EQ(1000, pool_.bytes_allocated());
+  pool_.Free(data, 1000);
+
+  pool_.ReleaseThreadCache();
+  ASSERT_EQ(0, pool_.bytes_allocated());
+}
+
+TEST_F(TestThreadCachingMemoryPool, MaxMemory) {
+  ASSERT_EQ(0, pool_.max_memory());
+
+  uint8_t* data;
+  ASSERT_OK(pool_.Allocate(100, &data));
+
+  uint8_t* data2;
+  ASSERT_OK(pool_.Allocate(100, &data2));
+
+  pool_.Free(data, 100);
+  pool_.Free(data2, 100);
+
+  ASSERT_EQ(200, pool_.max_memory());
+
+  // Large enough to publish the counters
+  const int64_t large_size = 4 << 20;
+  ASSERT_OK(pool_.Allocate(large_size, &data));
+  ASSERT_EQ(large_size, pool_.bytes_allocated());
+  pool_.Free(data, large_size);
+
+  ASSERT_EQ(0, pool_.bytes_allocated());
+  ASSERT_EQ(large_size, pool_.max_memory());
+}
+
+TEST_F(TestThreadCachingMemoryPool, MultipleThreads) {
+  const int num_threads = 8;
+  const int num_blocks = 1000;
+
+  std::vector<std::vector<uint8_t*>> blocks(num_threads);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < num_threads; ++i) {
+    threads.emplace_back([this, i, &blocks]() {
+      for (int j = 0; j < num_blocks; ++j) {
+        uint8_t* data;
+        ABORT_NOT_OK(pool_.Allocate(64 + j, &data));
+        EXPECT_EQ(0, reinterpret_cast<uintptr_t>(data) % 64);
+        memset(data, i, 64 + j);
+        if (j % 2 == 0) {
+          pool_.Free(data, 64 + j);
+        } else {
+          blocks[i].push_back(data);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  int64_t expected = 0;
+  for (int j = 1; j < num_blocks; j += 2) {
+    expected += 64 + j;
+  }
+  ASSERT_EQ(expected * num_threads, pool_.bytes_allocated());
+  ASSERT_GE(pool_.max_memory(), expected * num_threads);
+
+  // Blocks may be freed on a different thread than they were allocated on
+  for (int i = 0; i < num_threads; ++i) {
+    for (size_t j = 0; j < blocks[i].size(); ++j) {
+      ASSERT_EQ(static_cast<uint8_t>(i), blocks[i][j][0]);
+      pool_.Free(blocks[i][j], 64 + 2 * j + 1);
+    }
+  }
+  ASSERT_EQ(0, pool_.bytes_allocated());
+}
+
+class TestArenaMemoryPool : public ::arrow::test::TestMemoryPoolBase {
+ public:
+  TestArenaMemoryPool() : pool_(&parent_, 4096) {}
+
+  ::arrow::MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  DefaultMemoryPool parent_;
+  ArenaMemoryPool pool_;
+};
+
+TEST_F(TestArenaMemoryPool, MemoryTracking) {
+  this->TestMemoryTracking();
+}
+
+TEST_F(TestArenaMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestArenaMemoryPool, Reallocate) {
+  this->TestReallocate();
+}
+
+TEST_F(TestArenaMemoryPool, BumpAllocation) {
+  uint8_t* data1;
+  uint8_t* data2;
+  ASSERT_OK(pool_.Allocate(10, &data1));
+  ASSERT_OK(pool_.Allocate(100, &data2));
+  ASSERT_EQ(data1 + 64, data2);
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data2) % 64);
+  ASSERT_EQ(4096, parent_.bytes_allocated());
+
+  // The last allocation grows in place
+  data2[99] = 42;
+  ASSERT_OK(pool_.Reallocate(100, 1000, &data2));
+  ASSERT_EQ(data1 + 64, data2);
+  ASSERT_EQ(1010, pool_.bytes_allocated());
+
+  // Earlier allocations are moved when growing
+  ASSERT_OK(pool_.Reallocate(10, 200, &data1));
+  ASSERT_EQ(data2 + 1024, data1);
+  ASSERT_EQ(42, data2[99]);
+
+  // Does not fit into the rest of the chunk any more
+  uint8_t* data3;
+  ASSERT_OK(pool_.Allocate(3000, &data3));
+  ASSERT_EQ(8192, parent_.bytes_allocated());
+
+  pool_.Free(data1, 200);
+  pool_.Free(data2, 1000);
+  pool_.Free(data3, 3000);
+  ASSERT_EQ(0, pool_.bytes_allocated());
+  ASSERT_EQ(4200, pool_.max_memory());
+
+  // Chunks are kept and reused after a reset
+  pool_.Reset();
+  ASSERT_EQ(8192, pool_.bytes_reserved());
+  uint8_t* data4;
+  ASSERT_OK(pool_.Allocate(10, &data4));
+  ASSERT_EQ(data4 + 64, data2);
+  pool_.Free(data4, 10);
+}
+
+TEST_F(TestArenaMemoryPool, LargeAllocation) {
+  uint8_t* data;
+  ASSERT_OK(pool_.Allocate(10000, &data));
+  ASSERT_EQ(10048, parent_.bytes_allocated());
+  data[9999] = 7;
+
+  ASSERT_OK(pool_.Reallocate(10000, 20000, &data));
+  ASSERT_EQ(7, data[9999]);
+  ASSERT_EQ(20032, parent_.bytes_allocated());
+  ASSERT_EQ(20000, pool_.bytes_allocated());
+
+  pool_.Free(data, 20000);
+  pool_.Reset();
+  ASSERT_EQ(0, parent_.bytes_allocated());
+}
+
+TEST_F(TestArenaMemoryPool, BuildArrays) {
+  for (int round = 0; round < 3; ++round) {
+    Int32Builder builder(&pool_);
+    for (int32_t i = 0; i < 2000; ++i) {
+      ASSERT_OK(builder.Append(i));
+    }
+    std::shared_ptr<Array> out;
+    ASSERT_OK(builder.Finish(&out));
+    ASSERT_EQ(2000, out->length());
+    ASSERT_EQ(1999, std::static_pointer_cast<Int32Array>(out)->Value(1999));
+    out.reset();
+
+    ASSERT_EQ(0, pool_.bytes_allocated());
+    pool_.Reset();
+  }
+  // Steady state does not need new chunks from the parent
+  ASSERT_EQ(pool_.bytes_reserved(), parent_.bytes_allocated());
+  ASSERT_LE(parent_.bytes_allocated(), 4 * 4096);
+}
+
+class TestInstrumentedMemoryPool : public ::arrow::test::TestMemoryPoolBase {
+ public:
+  TestInstrumentedMemoryPool() : pool_(&parent_, true) {}
+
+  ::arrow::MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  DefaultMemoryPool parent_;
+  InstrumentedMemoryPool pool_;
+};
+
+TEST_F(TestInstrumentedMemoryPool, MemoryTracking) {
+  this->TestMemoryTracking();
+}
+
+TEST_F(TestInstrumentedMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestInstrumentedMemoryPool, Reallocate) {
+  this->TestReallocate();
+}
+
+TEST(InstrumentedMemoryPool, Stats) {
+  InstrumentedMemoryPool pool;
+
+  uint8_t* data1;
+  uint8_t* data2;
+  ASSERT_OK(pool.Allocate(0, &data1));
+  ASSERT_OK(pool.Reallocate(0, 100, &data1));
+  ASSERT_OK(pool.Allocate(1 << 20, &data2));
+  pool.Free(data1, 100);
+
+  MemoryPoolStats stats = pool.GetStats();
+  ASSERT_EQ((1 << 20), stats.bytes_allocated);
+  ASSERT_EQ((1 << 20) + 100, stats.max_memory);
+  ASSERT_EQ(2, stats.num_allocations);
+  ASSERT_EQ(1, stats.num_reallocations);
+  ASSERT_LE(stats.num_reallocation_copies, 1);
+  ASSERT_EQ(1, stats.num_frees);
+  ASSERT_GE(stats.allocate_nanos, 0);
+  ASSERT_TRUE(stats.bytes_by_tag.empty());
+
+  ASSERT_EQ(InstrumentedMemoryPool::kNumSizeBuckets,
+      static_cast<int>(stats.size_histogram.size()));
+  ASSERT_EQ(1, stats.size_histogram[0]);
+  // 64 <= 100 < 128
+  ASSERT_EQ(1, stats.size_histogram[7]);
+  ASSERT_EQ(1, stats.size_histogram[21]);
+
+  pool.Free(data2, 1 << 20);
+  ASSERT_EQ(0, pool.bytes_allocated());
+}
+
+TEST_F(TestInstrumentedMemoryPool, Tags) {
+  int decoder_tag;
+  int other_tag;
+  ASSERT_OK(InstrumentedMemoryPool::RegisterTag("decoder", &decoder_tag));
+  ASSERT_OK(InstrumentedMemoryPool::RegisterTag("other", &other_tag));
+  int tag;
+  ASSERT_OK(InstrumentedMemoryPool::RegisterTag("decoder", &tag));
+  ASSERT_EQ(decoder_tag, tag);
+
+  uint8_t* data1;
+  uint8_t* data2;
+  ASSERT_OK(pool_.Allocate(10, &data1));
+  {
+    InstrumentedMemoryPool::ScopedTag scope(decoder_tag);
+    ASSERT_OK(pool_.Allocate(1000, &data2));
+  }
+  // Reallocations stay charged to the tag of the original allocation
+  ASSERT_OK(pool_.Reallocate(1000, 2000, &data2));
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data2) % 64);
+
+  auto bytes_for_tag = [](const MemoryPoolStats& stats, const std::string& name) {
+    for (const auto& entry : stats.bytes_by_tag) {
+      if (entry.first == name) { return entry.second; }
+    }
+    return static_cast<int64_t>(-1);
+  };
+  MemoryPoolStats stats = pool_.GetStats();
+  ASSERT_EQ(10, bytes_for_tag(stats, "untagged"));
+  ASSERT_EQ(2000, bytes_for_tag(stats, "decoder"));
+  ASSERT_EQ(0, bytes_for_tag(stats, "other"));
+
+  std::thread thread([this, &data2]() { pool_.Free(data2, 2000); });
+  thread.join();
+  pool_.Free(data1, 10);
+
+  stats = pool_.GetStats();
+  ASSERT_EQ(0, bytes_for_tag(stats, "decoder"));
+  ASSERT_EQ(0, bytes_for_tag(stats, "untagged"));
+  ASSERT_EQ(0, parent_.bytes_allocated());
+}
+
 TEST(LoggingMemoryPool, Logging) {
   DefaultMemoryPool pool;
   LoggingMemoryPool lp(&pool);
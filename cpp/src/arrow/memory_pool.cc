@@ -18,15 +18,31 @@
 #include "arrow/memory_pool.h"
 
 #include <algorithm>
+#include <cerrno>
+#include <chrono>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <limits>
 #include <mutex>
 #include <sstream>
 #include <stdlib.h>
+#include <unordered_set>
+#include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/bit-util.h"
 #include "arrow/util/logging.h"
 
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
 #ifdef ARROW_JEMALLOC
 // Needed to support jemalloc 3 and 4
 #define JEMALLOC_MANGLE
@@ -37,7 +53,73 @@ namespace arrow {
 
 constexpr size_t kAlignment = 64;
 
+// Use mremap() to grow and shrink large allocations without copying. Not
+// needed with jemalloc, whose rallocx() already does so.
+#if defined(__linux__) && !defined(ARROW_JEMALLOC)
+#define ARROW_MREMAP_LARGE_ALLOCATIONS
+#endif
+
 namespace {
+
+#ifdef ARROW_MREMAP_LARGE_ALLOCATIONS
+// Allocations of at least this size are mapped from the operating system
+constexpr int64_t kMmapThreshold = 4 << 20;
+
+// Mapped allocations start with a header recording their size, so that the
+// mapping is always released and remapped with its true length. Keeps the
+// alignment of the returned memory.
+constexpr int64_t kMmapHeaderSize = static_cast<int64_t>(kAlignment);
+
+inline uint8_t* MmapBase(uint8_t* buffer) {
+  return buffer - kMmapHeaderSize;
+}
+
+inline int64_t MmapRecordedSize(uint8_t* buffer) {
+  int64_t size;
+  memcpy(&size, MmapBase(buffer), sizeof(size));
+  return size;
+}
+
+inline uint8_t* MmapSetRecordedSize(void* base, int64_t size) {
+  memcpy(base, &size, sizeof(size));
+  return reinterpret_cast<uint8_t*>(base) + kMmapHeaderSize;
+}
+
+// Mapped allocations are tracked by address, so that freeing or resizing
+// them never depends on the size the caller passes in
+std::mutex& MappedLock() {
+  // Never destroyed, as memory may still be freed during static destruction
+  static std::mutex* lock = new std::mutex();
+  return *lock;
+}
+
+std::unordered_set<const uint8_t*>& MappedAllocations() {
+  static auto* allocations = new std::unordered_set<const uint8_t*>();
+  return *allocations;
+}
+
+void SetMappedAllocation(const uint8_t* buffer, bool mapped) {
+  std::lock_guard<std::mutex> guard(MappedLock());
+  if (mapped) {
+    MappedAllocations().insert(buffer);
+  } else {
+    MappedAllocations().erase(buffer);
+  }
+}
+
+bool IsMappedAllocation(const uint8_t* buffer) {
+  // Mappings are page-aligned, so only addresses one header past a page
+  // boundary need to be looked up
+  constexpr uintptr_t kMinPageSize = 4096;
+  if (reinterpret_cast<uintptr_t>(buffer) % kMinPageSize !=
+      static_cast<uintptr_t>(kMmapHeaderSize)) {
+    return false;
+  }
+  std::lock_guard<std::mutex> guard(MappedLock());
+  return MappedAllocations().count(buffer) > 0;
+}
+#endif
+
 // Allocate memory according to the alignment requirements for Arrow
 // (as of May 2016 64 bytes)
 Status AllocateAligned(int64_t size, uint8_t** out) {
@@ -60,6 +142,21 @@ Status AllocateAligned(int64_t size, uint8_t** out) {
     return Status::OutOfMemory(ss.str());
   }
 #else
+#ifdef ARROW_MREMAP_LARGE_ALLOCATIONS
+  if (size >= kMmapThreshold) {
+    // Page-aligned, so the memory after the header is suitably aligned
+    void* result = mmap(nullptr, static_cast<size_t>(size + kMmapHeaderSize),
+        PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (result == MAP_FAILED) {
+      std::stringstream ss;
+      ss << "malloc of size " << size << " failed";
+      return Status::OutOfMemory(ss.str());
+    }
+    *out = MmapSetRecordedSize(result, size);
+    SetMappedAllocation(*out, true);
+    return Status::OK();
+  }
+#endif
   const int result = posix_memalign(
       reinterpret_cast<void**>(out), kAlignment, static_cast<size_t>(size));
   if (result == ENOMEM) {
@@ -76,6 +173,76 @@ Status AllocateAligned(int64_t size, uint8_t** out) {
 #endif
   return Status::OK();
 }
+
+// Release memory obtained from AllocateAligned. The size must be the one
+// the memory was allocated or last reallocated with.
+void FreeAligned(uint8_t* buffer, int64_t size) {
+#ifdef _MSC_VER
+  _aligned_free(buffer);
+#elif defined(ARROW_JEMALLOC)
+  dallocx(buffer, MALLOCX_ALIGN(kAlignment));
+#else
+#ifdef ARROW_MREMAP_LARGE_ALLOCATIONS
+  if (IsMappedAllocation(buffer)) {
+    const int64_t mapped_size = MmapRecordedSize(buffer);
+    DCHECK_EQ(mapped_size, size);
+    SetMappedAllocation(buffer, false);
+    munmap(MmapBase(buffer), static_cast<size_t>(mapped_size + kMmapHeaderSize));
+    return;
+  }
+#endif
+  std::free(buffer);
+#endif
+}
+
+// Resize memory obtained from AllocateAligned
+Status ReallocateAligned(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+#ifdef ARROW_JEMALLOC
+  *ptr = reinterpret_cast<uint8_t*>(rallocx(*ptr, new_size, MALLOCX_ALIGN(kAlignment)));
+  if (*ptr == NULL) {
+    std::stringstream ss;
+    ss << "realloc of size " << new_size << " failed";
+    return Status::OutOfMemory(ss.str());
+  }
+#else
+#ifdef ARROW_MREMAP_LARGE_ALLOCATIONS
+  if (new_size >= kMmapThreshold && IsMappedAllocation(*ptr)) {
+    // Let the kernel move the pages instead of copying them
+    const int64_t mapped_size = MmapRecordedSize(*ptr);
+    DCHECK_EQ(mapped_size, old_size);
+    void* result = mremap(MmapBase(*ptr),
+        static_cast<size_t>(mapped_size + kMmapHeaderSize),
+        static_cast<size_t>(new_size + kMmapHeaderSize), MREMAP_MAYMOVE);
+    if (result == MAP_FAILED) {
+      std::stringstream ss;
+      ss << "realloc of size " << new_size << " failed";
+      return Status::OutOfMemory(ss.str());
+    }
+    SetMappedAllocation(*ptr, false);
+    *ptr = MmapSetRecordedSize(result, new_size);
+    SetMappedAllocation(*ptr, true);
+    return Status::OK();
+  }
+#endif
+  // Note: We cannot use realloc() here as it doesn't guarantee alignment.
+
+  // Allocate new chunk
+  uint8_t* out;
+  RETURN_NOT_OK(AllocateAligned(new_size, &out));
+  // Copy contents and release old memory chunk
+  memcpy(out, *ptr, static_cast<size_t>(std::min(new_size, old_size)));
+  FreeAligned(*ptr, old_size);
+  *ptr = out;
+#endif  // defined(ARROW_JEMALLOC)
+  return Status::OK();
+}
+
+// Raise the peak counter to at least the given value
+void UpdateMaxMemory(std::atomic<int64_t>* max_memory, int64_t value) {
+  int64_t current = max_memory->load();
+  while (value > current && !max_memory->compare_exchange_weak(current, value)) {
+  }
+}
 }  // namespace
 
 MemoryPool::MemoryPool() {}
@@ -102,28 +269,7 @@ Status DefaultMemoryPool::Allocate(int64_t size, uint8_t** out) {
 }
 
 Status DefaultMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
-#ifdef ARROW_JEMALLOC
-  *ptr = reinterpret_cast<uint8_t*>(rallocx(*ptr, new_size, MALLOCX_ALIGN(kAlignment)));
-  if (*ptr == NULL) {
-    std::stringstream ss;
-    ss << "realloc of size " << new_size << " failed";
-    return Status::OutOfMemory(ss.str());
-  }
-#else
-  // Note: We cannot use realloc() here as it doesn't guarantee alignment.
-
-  // Allocate new chunk
-  uint8_t* out;
-  RETURN_NOT_OK(AllocateAligned(new_size, &out));
-  // Copy contents and release old memory chunk
-  memcpy(out, *ptr, static_cast<size_t>(std::min(new_size, old_size)));
-#ifdef _MSC_VER
-  _aligned_free(*ptr);
-#else
-  std::free(*ptr);
-#endif  // defined(_MSC_VER)
-  *ptr = out;
-#endif  // defined(ARROW_JEMALLOC)
+  RETURN_NOT_OK(ReallocateAligned(old_size, new_size, ptr));
 
   bytes_allocated_ += new_size - old_size;
   {
@@ -140,13 +286,7 @@ int64_t DefaultMemoryPool::bytes_allocated() const {
 
 void DefaultMemoryPool::Free(uint8_t* buffer, int64_t size) {
   DCHECK_GE(bytes_allocated_, size);
-#ifdef _MSC_VER
-  _aligned_free(buffer);
-#elif defined(ARROW_JEMALLOC)
-  dallocx(buffer, MALLOCX_ALIGN(kAlignment));
-#else
-  std::free(buffer);
-#endif
+  FreeAligned(buffer, size);
   bytes_allocated_ -= size;
 }
 
@@ -161,6 +301,839 @@ MemoryPool* default_memory_pool() {
   return &default_memory_pool_;
 }
 
+// ----------------------------------------------------------------------
+// InstrumentedMemoryPool
+
+constexpr int InstrumentedMemoryPool::kNumSizeBuckets;
+constexpr int InstrumentedMemoryPool::kMaxTags;
+
+namespace {
+
+// Size of the header holding the tag of an allocation, keeps the alignment
+constexpr int64_t kTagHeaderSize = static_cast<int64_t>(kAlignment);
+
+// The tag allocations of the current thread are charged to
+thread_local int current_memory_tag = 0;
+
+std::mutex& memory_tag_lock() {
+  static std::mutex lock;
+  return lock;
+}
+
+std::vector<std::string>& memory_tag_names() {
+  static std::vector<std::string> names = {"untagged"};
+  return names;
+}
+
+int64_t ElapsedNanos(const std::chrono::steady_clock::time_point& start) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+}  // namespace
+
+InstrumentedMemoryPool::InstrumentedMemoryPool(MemoryPool* parent, bool track_tags)
+    : parent_(parent == nullptr ? default_memory_pool() : parent),
+      track_tags_(track_tags),
+      bytes_allocated_(0),
+      max_memory_(0),
+      num_allocations_(0),
+      num_reallocations_(0),
+      num_reallocation_copies_(0),
+      num_frees_(0),
+      allocate_nanos_(0),
+      reallocate_nanos_(0),
+      free_nanos_(0) {
+  for (auto& count : size_histogram_) {
+    count = 0;
+  }
+  for (auto& bytes : bytes_by_tag_) {
+    bytes = 0;
+  }
+}
+
+InstrumentedMemoryPool::~InstrumentedMemoryPool() {}
+
+void InstrumentedMemoryPool::RecordSize(int64_t size) {
+  const int bucket = 64 - BitUtil::CountLeadingZeros(static_cast<uint64_t>(size));
+  size_histogram_[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+Status InstrumentedMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  const auto start = std::chrono::steady_clock::now();
+  if (track_tags_) {
+    if (size > std::numeric_limits<int64_t>::max() - kTagHeaderSize) {
+      std::stringstream ss;
+      ss << "malloc of size " << size << " failed";
+      return Status::OutOfMemory(ss.str());
+    }
+    uint8_t* header;
+    RETURN_NOT_OK(parent_->Allocate(size + kTagHeaderSize, &header));
+    const int tag = current_memory_tag;
+    *reinterpret_cast<int*>(header) = tag;
+    bytes_by_tag_[tag].fetch_add(size, std::memory_order_relaxed);
+    *out = header + kTagHeaderSize;
+  } else {
+    RETURN_NOT_OK(parent_->Allocate(size, out));
+  }
+  allocate_nanos_.fetch_add(ElapsedNanos(start), std::memory_order_relaxed);
+
+  num_allocations_.fetch_add(1, std::memory_order_relaxed);
+  RecordSize(size);
+  UpdateMaxMemory(&max_memory_, bytes_allocated_ += size);
+  return Status::OK();
+}
+
+Status InstrumentedMemoryPool::Reallocate(
+    int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  const auto start = std::chrono::steady_clock::now();
+  const uint8_t* old_ptr = *ptr;
+  if (track_tags_) {
+    if (new_size > std::numeric_limits<int64_t>::max() - kTagHeaderSize) {
+      std::stringstream ss;
+      ss << "realloc of size " << new_size << " failed";
+      return Status::OutOfMemory(ss.str());
+    }
+    uint8_t* header = *ptr - kTagHeaderSize;
+    RETURN_NOT_OK(parent_->Reallocate(
+        old_size + kTagHeaderSize, new_size + kTagHeaderSize, &header));
+    const int tag = *reinterpret_cast<int*>(header);
+    bytes_by_tag_[tag].fetch_add(new_size - old_size, std::memory_order_relaxed);
+    *ptr = header + kTagHeaderSize;
+  } else {
+    RETURN_NOT_OK(parent_->Reallocate(old_size, new_size, ptr));
+  }
+  reallocate_nanos_.fetch_add(ElapsedNanos(start), std::memory_order_relaxed);
+
+  num_reallocations_.fetch_add(1, std::memory_order_relaxed);
+  if (*ptr != old_ptr) {
+    num_reallocation_copies_.fetch_add(1, std::memory_order_relaxed);
+  }
+  RecordSize(new_size);
+  UpdateMaxMemory(&max_memory_, bytes_allocated_ += new_size - old_size);
+  return Status::OK();
+}
+
+void InstrumentedMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  DCHECK_GE(bytes_allocated_, size);
+  const auto start = std::chrono::steady_clock::now();
+  if (track_tags_) {
+    uint8_t* header = buffer - kTagHeaderSize;
+    const int tag = *reinterpret_cast<int*>(header);
+    bytes_by_tag_[tag].fetch_sub(size, std::memory_order_relaxed);
+    parent_->Free(header, size + kTagHeaderSize);
+  } else {
+    parent_->Free(buffer, size);
+  }
+  free_nanos_.fetch_add(ElapsedNanos(start), std::memory_order_relaxed);
+
+  num_frees_.fetch_add(1, std::memory_order_relaxed);
+  bytes_allocated_ -= size;
+}
+
+int64_t InstrumentedMemoryPool::bytes_allocated() const {
+  return bytes_allocated_.load();
+}
+
+int64_t InstrumentedMemoryPool::max_memory() const {
+  return max_memory_.load();
+}
+
+MemoryPoolStats InstrumentedMemoryPool::GetStats() const {
+  MemoryPoolStats stats;
+  stats.bytes_allocated = bytes_allocated_.load();
+  stats.max_memory = max_memory_.load();
+  stats.num_allocations = num_allocations_.load();
+  stats.num_reallocations = num_reallocations_.load();
+  stats.num_reallocation_copies = num_reallocation_copies_.load();
+  stats.num_frees = num_frees_.load();
+  stats.allocate_nanos = allocate_nanos_.load();
+  stats.reallocate_nanos = reallocate_nanos_.load();
+  stats.free_nanos = free_nanos_.load();
+
+  for (const auto& count : size_histogram_) {
+    stats.size_histogram.push_back(count.load());
+  }
+
+  if (track_tags_) {
+    std::lock_guard<std::mutex> guard(memory_tag_lock());
+    const auto& names = memory_tag_names();
+    for (size_t i = 0; i < names.size(); ++i) {
+      stats.bytes_by_tag.emplace_back(names[i], bytes_by_tag_[i].load());
+    }
+  }
+  return stats;
+}
+
+Status InstrumentedMemoryPool::RegisterTag(const std::string& name, int* tag) {
+  std::lock_guard<std::mutex> guard(memory_tag_lock());
+  auto& names = memory_tag_names();
+  auto it = std::find(names.begin(), names.end(), name);
+  if (it != names.end()) {
+    *tag = static_cast<int>(it - names.begin());
+    return Status::OK();
+  }
+  if (names.size() == kMaxTags) {
+    std::stringstream ss;
+    ss << "Cannot register more than " << kMaxTags << " memory pool tags";
+    return Status::Invalid(ss.str());
+  }
+  *tag = static_cast<int>(names.size());
+  names.push_back(name);
+  return Status::OK();
+}
+
+InstrumentedMemoryPool::ScopedTag::ScopedTag(int tag)
+    : previous_tag_(current_memory_tag) {
+  DCHECK_GE(tag, 0);
+  DCHECK_LT(tag, kMaxTags);
+  current_memory_tag = tag;
+}
+
+InstrumentedMemoryPool::ScopedTag::~ScopedTag() {
+  current_memory_tag = previous_tag_;
+}
+
+// ----------------------------------------------------------------------
+// ProxyMemoryPool
+
+ProxyMemoryPool::ProxyMemoryPool(MemoryPool* parent, int64_t limit)
+    : parent_(parent == nullptr ? default_memory_pool() : parent),
+      limit_(limit),
+      bytes_allocated_(0),
+      max_memory_(0),
+      num_rejected_(0) {}
+
+ProxyMemoryPool::~ProxyMemoryPool() {}
+
+Status ProxyMemoryPool::Reserve(int64_t size) {
+  // Only commit the new total once it is known to be within the limit, so
+  // that concurrent callers never see (or are rejected by) an overshoot
+  int64_t current = bytes_allocated_.load();
+  do {
+    if (limit_ >= 0 && size > 0 && current + size > limit_) {
+      ++num_rejected_;
+      std::stringstream ss;
+      ss << "allocation of " << size << " bytes would exceed the memory pool limit of "
+         << limit_ << " bytes (" << current << " bytes in use)";
+      return Status::OutOfMemory(ss.str());
+    }
+  } while (!bytes_allocated_.compare_exchange_weak(current, current + size));
+  return Status::OK();
+}
+
+Status ProxyMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  RETURN_NOT_OK(Reserve(size));
+  Status s = parent_->Allocate(size, out);
+  if (!s.ok()) {
+    bytes_allocated_ -= size;
+    return s;
+  }
+  UpdateMaxMemory(&max_memory_, bytes_allocated_.load());
+  return Status::OK();
+}
+
+Status ProxyMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  const int64_t delta = new_size - old_size;
+  RETURN_NOT_OK(Reserve(delta));
+  Status s = parent_->Reallocate(old_size, new_size, ptr);
+  if (!s.ok()) {
+    bytes_allocated_ -= delta;
+    return s;
+  }
+  UpdateMaxMemory(&max_memory_, bytes_allocated_.load());
+  return Status::OK();
+}
+
+void ProxyMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  DCHECK_GE(bytes_allocated_, size);
+  parent_->Free(buffer, size);
+  bytes_allocated_ -= size;
+}
+
+int64_t ProxyMemoryPool::bytes_allocated() const {
+  return bytes_allocated_.load();
+}
+
+int64_t ProxyMemoryPool::max_memory() const {
+  return max_memory_.load();
+}
+
+int64_t ProxyMemoryPool::num_rejected() const {
+  return num_rejected_.load();
+}
+
+// ----------------------------------------------------------------------
+// HugePageMemoryPool
+
+constexpr int64_t HugePageMemoryPool::kHugePageSize;
+
+#ifdef __linux__
+// From linux/mempolicy.h
+constexpr int kMemoryPolicyBind = 2;
+#endif
+
+HugePageMemoryPool::HugePageMemoryPool(
+    int numa_node, bool use_hugetlb, int64_t huge_page_threshold)
+    : numa_node_(numa_node),
+      use_hugetlb_(use_hugetlb),
+      huge_page_threshold_(huge_page_threshold),
+      bytes_allocated_(0),
+      max_memory_(0) {}
+
+HugePageMemoryPool::~HugePageMemoryPool() {}
+
+Status HugePageMemoryPool::MapHugePages(int64_t size, uint8_t** out) {
+#ifdef _WIN32
+  return AllocateAligned(size, out);
+#else
+  if (size > std::numeric_limits<int64_t>::max() - 2 * kHugePageSize) {
+    std::stringstream ss;
+    ss << "malloc of size " << size << " failed";
+    return Status::OutOfMemory(ss.str());
+  }
+  const int64_t length = BitUtil::RoundUp(size, kHugePageSize);
+
+  void* result = MAP_FAILED;
+#ifdef MAP_HUGETLB
+  if (use_hugetlb_) {
+    result = mmap(nullptr, static_cast<size_t>(length), PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  }
+#endif
+
+  if (result == MAP_FAILED) {
+    // Over-allocate so that the mapping can be trimmed to a 2 MB boundary,
+    // which transparent huge pages require
+    const size_t mapped_length = static_cast<size_t>(length + kHugePageSize);
+    void* mapped = mmap(nullptr, mapped_length, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapped == MAP_FAILED) {
+      std::stringstream ss;
+      ss << "malloc of size " << size << " failed";
+      return Status::OutOfMemory(ss.str());
+    }
+    uint8_t* start = reinterpret_cast<uint8_t*>(mapped);
+    uint8_t* aligned = reinterpret_cast<uint8_t*>(
+        BitUtil::RoundUp(reinterpret_cast<int64_t>(start), kHugePageSize));
+    if (aligned > start) { munmap(start, aligned - start); }
+    const int64_t tail = (start + mapped_length) - (aligned + length);
+    if (tail > 0) { munmap(aligned + length, static_cast<size_t>(tail)); }
+    result = aligned;
+#ifdef MADV_HUGEPAGE
+    // Only a hint, not supported by all kernels
+    madvise(result, static_cast<size_t>(length), MADV_HUGEPAGE);
+#endif
+  }
+
+#ifdef __linux__
+  if (numa_node_ >= 0) {
+    // Bind before the pages are touched, so that they are faulted in on the
+    // requested node
+    const int bits_per_word = sizeof(unsigned long) * 8;  // NOLINT
+    std::vector<unsigned long> node_mask(  // NOLINT
+        numa_node_ / bits_per_word + 1, 0);
+    node_mask[numa_node_ / bits_per_word] = 1UL << (numa_node_ % bits_per_word);
+    if (syscall(SYS_mbind, result, static_cast<unsigned long>(length),  // NOLINT
+            kMemoryPolicyBind, node_mask.data(), node_mask.size() * bits_per_word + 1,
+            0) != 0) {
+      const int error = errno;
+      munmap(result, static_cast<size_t>(length));
+      std::stringstream ss;
+      ss << "Unable to bind memory to NUMA node " << numa_node_ << ": "
+         << std::strerror(error);
+      return Status::IOError(ss.str());
+    }
+  }
+#endif
+
+  *out = reinterpret_cast<uint8_t*>(result);
+  return Status::OK();
+#endif
+}
+
+void HugePageMemoryPool::UnmapHugePages(uint8_t* buffer, int64_t size) {
+#ifdef _WIN32
+  FreeAligned(buffer, size);
+#else
+  munmap(buffer, static_cast<size_t>(BitUtil::RoundUp(size, kHugePageSize)));
+#endif
+}
+
+Status HugePageMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  if (IsMapped(size)) {
+    RETURN_NOT_OK(MapHugePages(size, out));
+  } else {
+    RETURN_NOT_OK(AllocateAligned(size, out));
+  }
+  UpdateMaxMemory(&max_memory_, bytes_allocated_ += size);
+  return Status::OK();
+}
+
+Status HugePageMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  if (IsMapped(old_size) && IsMapped(new_size) &&
+      BitUtil::RoundUp(old_size, kHugePageSize) ==
+          BitUtil::RoundUp(new_size, kHugePageSize)) {
+    // Still fits into the same mapping
+    UpdateMaxMemory(&max_memory_, bytes_allocated_ += new_size - old_size);
+    return Status::OK();
+  }
+
+  uint8_t* out;
+  if (IsMapped(new_size)) {
+    RETURN_NOT_OK(MapHugePages(new_size, &out));
+  } else {
+    RETURN_NOT_OK(AllocateAligned(new_size, &out));
+  }
+  memcpy(out, *ptr, static_cast<size_t>(std::min(new_size, old_size)));
+  if (IsMapped(old_size)) {
+    UnmapHugePages(*ptr, old_size);
+  } else {
+    FreeAligned(*ptr, old_size);
+  }
+  *ptr = out;
+
+  UpdateMaxMemory(&max_memory_, bytes_allocated_ += new_size - old_size);
+  return Status::OK();
+}
+
+void HugePageMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  DCHECK_GE(bytes_allocated_, size);
+  if (IsMapped(size)) {
+    UnmapHugePages(buffer, size);
+  } else {
+    FreeAligned(buffer, size);
+  }
+  bytes_allocated_ -= size;
+}
+
+int64_t HugePageMemoryPool::bytes_allocated() const {
+  return bytes_allocated_.load();
+}
+
+int64_t HugePageMemoryPool::max_memory() const {
+  return max_memory_.load();
+}
+
+// ----------------------------------------------------------------------
+// ThreadCachingMemoryPool
+
+namespace {
+
+// Smallest size class; every cached block is at least this large
+constexpr int64_t kMinCachedSize = static_cast<int64_t>(kAlignment);
+
+// Size classes are the powers of two from 64 bytes up to 64 KB
+constexpr int kNumSizeClasses = 11;
+constexpr int64_t kMaxCachedSize = kMinCachedSize << (kNumSizeClasses - 1);
+
+// A thread keeps at most this many bytes on the free list of one size class
+constexpr int64_t kMaxCachedBytesPerClass = 1 << 20;
+
+// A thread publishes its allocation delta to the shared counters once its
+// magnitude reaches this many bytes
+constexpr int64_t kCounterBatchBytes = 1 << 20;
+
+int SizeClass(int64_t size) {
+  return size <= kMinCachedSize ? 0 : BitUtil::Log2(static_cast<uint64_t>(size)) - 6;
+}
+
+std::atomic<uint64_t> next_caching_pool_id(0);
+
+}  // namespace
+
+class ThreadCachingMemoryPool::ThreadCachingMemoryPoolImpl
+    : public std::enable_shared_from_this<ThreadCachingMemoryPoolImpl> {
+ public:
+  // Free lists and unpublished counters, used by one thread at a time
+  struct ThreadCache {
+    ThreadCache() : pending_bytes(0), pending_peak(0), attached(false) {
+      for (int i = 0; i < kNumSizeClasses; ++i) {
+        free_lists[i] = nullptr;
+        free_list_lengths[i] = 0;
+      }
+    }
+
+    // Singly linked lists threaded through the first bytes of each free block
+    uint8_t* free_lists[kNumSizeClasses];
+    int64_t free_list_lengths[kNumSizeClasses];
+
+    // Only written by the owning thread, read by other threads for stats
+    std::atomic<int64_t> pending_bytes;
+    std::atomic<int64_t> pending_peak;
+
+    // Guarded by the pool's lock_
+    bool attached;
+  };
+
+  ThreadCachingMemoryPoolImpl()
+      : id_(next_caching_pool_id++), bytes_allocated_(0), max_memory_(0) {}
+
+  ~ThreadCachingMemoryPoolImpl() {
+    for (auto& cache : caches_) {
+      ReleaseBlocks(cache.get());
+    }
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    ThreadCache* cache = LocalCache();
+    if (size > kMaxCachedSize) {
+      RETURN_NOT_OK(AllocateAligned(size, out));
+    } else {
+      const int size_class = SizeClass(size);
+      uint8_t* head = cache->free_lists[size_class];
+      if (head != nullptr) {
+        cache->free_lists[size_class] = *reinterpret_cast<uint8_t**>(head);
+        --cache->free_list_lengths[size_class];
+        *out = head;
+      } else {
+        RETURN_NOT_OK(AllocateAligned(kMinCachedSize << size_class, out));
+      }
+    }
+    UpdateCounters(cache, size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (old_size <= kMaxCachedSize && new_size <= kMaxCachedSize &&
+        SizeClass(old_size) == SizeClass(new_size)) {
+      // The block already has room for the new size
+      UpdateCounters(LocalCache(), new_size - old_size);
+      return Status::OK();
+    }
+    if (old_size > kMaxCachedSize && new_size > kMaxCachedSize) {
+      RETURN_NOT_OK(ReallocateAligned(old_size, new_size, ptr));
+      UpdateCounters(LocalCache(), new_size - old_size);
+      return Status::OK();
+    }
+    uint8_t* out;
+    RETURN_NOT_OK(Allocate(new_size, &out));
+    memcpy(out, *ptr, static_cast<size_t>(std::min(new_size, old_size)));
+    Free(*ptr, old_size);
+    *ptr = out;
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    ThreadCache* cache = LocalCache();
+    if (size > kMaxCachedSize) {
+      FreeAligned(buffer, size);
+    } else {
+      const int size_class = SizeClass(size);
+      if ((cache->free_list_lengths[size_class] << size_class) * kMinCachedSize <
+          kMaxCachedBytesPerClass) {
+        *reinterpret_cast<uint8_t**>(buffer) = cache->free_lists[size_class];
+        cache->free_lists[size_class] = buffer;
+        ++cache->free_list_lengths[size_class];
+      } else {
+        FreeAligned(buffer, kMinCachedSize << size_class);
+      }
+    }
+    UpdateCounters(cache, -size);
+  }
+
+  int64_t bytes_allocated() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    int64_t total = bytes_allocated_.load();
+    for (const auto& cache : caches_) {
+      total += cache->pending_bytes.load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+
+  int64_t max_memory() const {
+    // The sum of the per-thread peaks bounds the peak that was not published
+    // yet from above; it is exact if only one thread allocated since then
+    std::lock_guard<std::mutex> guard(lock_);
+    int64_t estimate = bytes_allocated_.load();
+    for (const auto& cache : caches_) {
+      estimate += cache->pending_peak.load(std::memory_order_relaxed);
+    }
+    return std::max(max_memory_.load(), estimate);
+  }
+
+  void ReleaseThreadCache() {
+    ThreadCache* cache = LocalCache();
+    ReleaseBlocks(cache);
+    PublishCounters(cache);
+  }
+
+ private:
+  // The caches the calling thread has attached to, one per pool
+  class ThreadRegistry {
+   public:
+    ~ThreadRegistry() {
+      for (auto& entry : entries_) {
+        auto pool = entry.pool.lock();
+        if (pool) { pool->DetachCache(entry.cache); }
+      }
+    }
+
+    ThreadCache* Find(uint64_t pool_id) const {
+      for (const auto& entry : entries_) {
+        if (entry.pool_id == pool_id) { return entry.cache; }
+      }
+      return nullptr;
+    }
+
+    void Add(const std::shared_ptr<ThreadCachingMemoryPoolImpl>& pool,
+        ThreadCache* cache) {
+      // Forget about pools that were destroyed in the meantime
+      entries_.erase(std::remove_if(entries_.begin(), entries_.end(),
+                         [](const Entry& entry) { return entry.pool.expired(); }),
+          entries_.end());
+      entries_.push_back({pool->id_, pool, cache});
+    }
+
+   private:
+    struct Entry {
+      uint64_t pool_id;
+      std::weak_ptr<ThreadCachingMemoryPoolImpl> pool;
+      ThreadCache* cache;
+    };
+    std::vector<Entry> entries_;
+  };
+
+  ThreadCache* LocalCache() {
+    static thread_local ThreadRegistry registry;
+    ThreadCache* cache = registry.Find(id_);
+    if (cache == nullptr) {
+      cache = AttachCache();
+      registry.Add(shared_from_this(), cache);
+    }
+    return cache;
+  }
+
+  // Hand out a cache left behind by an exited thread, or create a new one
+  ThreadCache* AttachCache() {
+    std::lock_guard<std::mutex> guard(lock_);
+    for (auto& cache : caches_) {
+      if (!cache->attached) {
+        cache->attached = true;
+        return cache.get();
+      }
+    }
+    caches_.emplace_back(new ThreadCache());
+    caches_.back()->attached = true;
+    return caches_.back().get();
+  }
+
+  void DetachCache(ThreadCache* cache) {
+    ReleaseBlocks(cache);
+    PublishCounters(cache);
+    std::lock_guard<std::mutex> guard(lock_);
+    cache->attached = false;
+  }
+
+  static void ReleaseBlocks(ThreadCache* cache) {
+    for (int i = 0; i < kNumSizeClasses; ++i) {
+      uint8_t* block = cache->free_lists[i];
+      while (block != nullptr) {
+        uint8_t* next = *reinterpret_cast<uint8_t**>(block);
+        FreeAligned(block, kMinCachedSize << i);
+        block = next;
+      }
+      cache->free_lists[i] = nullptr;
+      cache->free_list_lengths[i] = 0;
+    }
+  }
+
+  void UpdateCounters(ThreadCache* cache, int64_t delta) {
+    const int64_t pending =
+        cache->pending_bytes.load(std::memory_order_relaxed) + delta;
+    cache->pending_bytes.store(pending, std::memory_order_relaxed);
+    if (pending > cache->pending_peak.load(std::memory_order_relaxed)) {
+      cache->pending_peak.store(pending, std::memory_order_relaxed);
+    }
+    if (pending >= kCounterBatchBytes || pending <= -kCounterBatchBytes) {
+      PublishCounters(cache);
+    }
+  }
+
+  void PublishCounters(ThreadCache* cache) {
+    const int64_t pending = cache->pending_bytes.load(std::memory_order_relaxed);
+    const int64_t peak = cache->pending_peak.load(std::memory_order_relaxed);
+    cache->pending_bytes.store(0, std::memory_order_relaxed);
+    cache->pending_peak.store(0, std::memory_order_relaxed);
+    const int64_t previous = bytes_allocated_.fetch_add(pending);
+    UpdateMaxMemory(&max_memory_, previous + peak);
+  }
+
+  const uint64_t id_;
+
+  mutable std::mutex lock_;
+  std::vector<std::unique_ptr<ThreadCache>> caches_;
+
+  std::atomic<int64_t> bytes_allocated_;
+  std::atomic<int64_t> max_memory_;
+};
+
+ThreadCachingMemoryPool::ThreadCachingMemoryPool()
+    : impl_(std::make_shared<ThreadCachingMemoryPoolImpl>()) {}
+
+ThreadCachingMemoryPool::~ThreadCachingMemoryPool() {}
+
+Status ThreadCachingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status ThreadCachingMemoryPool::Reallocate(
+    int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void ThreadCachingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  impl_->Free(buffer, size);
+}
+
+int64_t ThreadCachingMemoryPool::bytes_allocated() const {
+  return impl_->bytes_allocated();
+}
+
+int64_t ThreadCachingMemoryPool::max_memory() const {
+  return impl_->max_memory();
+}
+
+void ThreadCachingMemoryPool::ReleaseThreadCache() {
+  impl_->ReleaseThreadCache();
+}
+
+// ----------------------------------------------------------------------
+// ArenaMemoryPool
+
+constexpr int64_t ArenaMemoryPool::kDefaultChunkSize;
+
+ArenaMemoryPool::ArenaMemoryPool(MemoryPool* parent, int64_t chunk_size)
+    : parent_(parent == nullptr ? default_memory_pool() : parent),
+      chunk_size_(BitUtil::RoundUpToMultipleOf64(chunk_size)),
+      current_chunk_(-1),
+      position_(0),
+      last_allocation_(nullptr),
+      bytes_allocated_(0),
+      max_memory_(0) {}
+
+ArenaMemoryPool::~ArenaMemoryPool() {
+  Reset();
+  for (const Chunk& chunk : chunks_) {
+    parent_->Free(chunk.data, chunk.size);
+  }
+}
+
+Status ArenaMemoryPool::NextChunk() {
+  if (current_chunk_ + 1 == static_cast<int64_t>(chunks_.size())) {
+    uint8_t* data;
+    RETURN_NOT_OK(parent_->Allocate(chunk_size_, &data));
+    chunks_.push_back({data, chunk_size_});
+  }
+  ++current_chunk_;
+  position_ = 0;
+  return Status::OK();
+}
+
+Status ArenaMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  // Never hand out empty slices, so that every allocation has a distinct address
+  const int64_t rounded_size =
+      BitUtil::RoundUpToMultipleOf64(std::max(size, static_cast<int64_t>(kAlignment)));
+
+  std::lock_guard<std::mutex> guard(lock_);
+  if (rounded_size > chunk_size_) {
+    RETURN_NOT_OK(parent_->Allocate(rounded_size, out));
+    large_blocks_.push_back({*out, rounded_size});
+  } else {
+    if (current_chunk_ < 0 || position_ + rounded_size > chunk_size_) {
+      RETURN_NOT_OK(NextChunk());
+    }
+    *out = chunks_[current_chunk_].data + position_;
+    position_ += rounded_size;
+    last_allocation_ = *out;
+  }
+  bytes_allocated_ += size;
+  max_memory_ = std::max(max_memory_, bytes_allocated_);
+  return Status::OK();
+}
+
+Status ArenaMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (*ptr == last_allocation_) {
+      // The most recent slice can be resized by moving the bump pointer
+      const int64_t new_end = BitUtil::RoundUpToMultipleOf64(
+          (*ptr - chunks_[current_chunk_].data) +
+          std::max(new_size, static_cast<int64_t>(kAlignment)));
+      if (new_end <= chunk_size_) {
+        position_ = new_end;
+        bytes_allocated_ += new_size - old_size;
+        max_memory_ = std::max(max_memory_, bytes_allocated_);
+        return Status::OK();
+      }
+    }
+
+    auto block = std::find_if(large_blocks_.begin(), large_blocks_.end(),
+        [ptr](const Chunk& chunk) { return chunk.data == *ptr; });
+    if (block != large_blocks_.end() && new_size > chunk_size_) {
+      // Dedicated blocks use the parent's reallocation, which may avoid a copy
+      const int64_t rounded_size = BitUtil::RoundUpToMultipleOf64(new_size);
+      RETURN_NOT_OK(parent_->Reallocate(block->size, rounded_size, &block->data));
+      block->size = rounded_size;
+      *ptr = block->data;
+      bytes_allocated_ += new_size - old_size;
+      max_memory_ = std::max(max_memory_, bytes_allocated_);
+      return Status::OK();
+    } else if (block == large_blocks_.end() && new_size <= old_size) {
+      // Shrinking a slice in the middle of a chunk leaves it where it is
+      bytes_allocated_ += new_size - old_size;
+      return Status::OK();
+    }
+  }
+
+  uint8_t* out;
+  RETURN_NOT_OK(Allocate(new_size, &out));
+  memcpy(out, *ptr, static_cast<size_t>(std::min(new_size, old_size)));
+  Free(*ptr, old_size);
+  *ptr = out;
+  return Status::OK();
+}
+
+void ArenaMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  std::lock_guard<std::mutex> guard(lock_);
+  DCHECK_GE(bytes_allocated_, size);
+  bytes_allocated_ -= size;
+}
+
+void ArenaMemoryPool::Reset() {
+  std::lock_guard<std::mutex> guard(lock_);
+  for (const Chunk& block : large_blocks_) {
+    parent_->Free(block.data, block.size);
+  }
+  large_blocks_.clear();
+  current_chunk_ = -1;
+  position_ = 0;
+  last_allocation_ = nullptr;
+}
+
+int64_t ArenaMemoryPool::bytes_allocated() const {
+  std::lock_guard<std::mutex> guard(lock_);
+  return bytes_allocated_;
+}
+
+int64_t ArenaMemoryPool::max_memory() const {
+  std::lock_guard<std::mutex> guard(lock_);
+  return max_memory_;
+}
+
+int64_t ArenaMemoryPool::bytes_reserved() const {
+  std::lock_guard<std::mutex> guard(lock_);
+  int64_t total = static_cast<int64_t>(chunks_.size()) * chunk_size_;
+  for (const Chunk& block : large_blocks_) {
+    total += block.size;
+  }
+  return total;
+}
+
+// ----------------------------------------------------------------------
+// LoggingMemoryPool
+
 LoggingMemoryPool::LoggingMemoryPool(MemoryPool* pool) : pool_(pool) {}
 
 Status LoggingMemoryPool::Allocate(int64_t size, uint8_t** out) {
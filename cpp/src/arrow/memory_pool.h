@@ -20,7 +20,11 @@
 
 #include <atomic>
 #include <cstdint>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "arrow/util/visibility.h"
 
@@ -52,7 +56,10 @@ class ARROW_EXPORT MemoryPool {
   /// @param buffer Pointer to the start of the allocated memory region
   /// @param size Allocated size located at buffer. An allocator implementation
   ///   may use this for tracking the amount of allocated bytes as well as for
-  ///   faster deallocation if supported by its backend.
+  ///   faster deallocation if supported by its backend. It must be exactly the
+  ///   size passed to the Allocate or Reallocate call that returned buffer: the
+  ///   default pool maps large allocations directly and picks how to release
+  ///   the memory by size. Debug builds check this where they can.
   virtual void Free(uint8_t* buffer, int64_t size) = 0;
 
   /// The number of bytes that were allocated and not yet free'd through
@@ -89,6 +96,10 @@ class ARROW_EXPORT DefaultMemoryPool : public MemoryPool {
   std::atomic<int64_t> max_memory_;
 };
 
+/// \brief A memory pool that prints every call to standard output
+///
+/// Only meant for debugging; use InstrumentedMemoryPool to collect allocation
+/// statistics.
 class ARROW_EXPORT LoggingMemoryPool : public MemoryPool {
  public:
   explicit LoggingMemoryPool(MemoryPool* pool);
@@ -107,6 +118,284 @@ class ARROW_EXPORT LoggingMemoryPool : public MemoryPool {
   MemoryPool* pool_;
 };
 
+/// \brief A snapshot of the statistics gathered by an InstrumentedMemoryPool
+struct ARROW_EXPORT MemoryPoolStats {
+  int64_t bytes_allocated;
+  int64_t max_memory;
+
+  int64_t num_allocations;
+  int64_t num_reallocations;
+  /// The number of reallocations that moved the data to a new address
+  int64_t num_reallocation_copies;
+  int64_t num_frees;
+
+  /// Time spent in the parent pool, in nanoseconds
+  int64_t allocate_nanos;
+  int64_t reallocate_nanos;
+  int64_t free_nanos;
+
+  /// Entry i counts the Allocate and Reallocate requests for sizes s with
+  /// 2^(i-1) <= s < 2^i; entry 0 counts zero-byte requests
+  std::vector<int64_t> size_histogram;
+
+  /// Live bytes for every registered caller tag, starting with the untagged
+  /// allocations. Empty unless the pool tracks tags.
+  std::vector<std::pair<std::string, int64_t>> bytes_by_tag;
+};
+
+/// \brief A memory pool that gathers allocation statistics for a parent pool
+///
+/// All counters are updated with lock-free atomic operations, and GetStats()
+/// may be called at any time, e.g. by a metrics exporter.
+///
+/// Optionally, live bytes can be attributed to caller tags: while a ScopedTag
+/// is alive, allocations on that thread are charged to its tag, and remain so
+/// until they are freed on any thread. To that end the pool prefixes every
+/// allocation with a 64-byte header, which the parent pool accounts for.
+class ARROW_EXPORT InstrumentedMemoryPool : public MemoryPool {
+ public:
+  static constexpr int kNumSizeBuckets = 64;
+  static constexpr int kMaxTags = 64;
+
+  /// \param[in] parent the pool to allocate from, the default pool if null
+  /// \param[in] track_tags whether to account live bytes per caller tag
+  explicit InstrumentedMemoryPool(MemoryPool* parent = nullptr, bool track_tags = false);
+  virtual ~InstrumentedMemoryPool();
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// Return a snapshot of the statistics gathered so far
+  MemoryPoolStats GetStats() const;
+
+  /// \brief Register a caller tag
+  ///
+  /// Tags are shared by all instrumented pools; registering the same name
+  /// again returns the same tag.
+  ///
+  /// \param[in] name a descriptive name of the caller
+  /// \param[out] tag the tag to pass to ScopedTag
+  static Status RegisterTag(const std::string& name, int* tag);
+
+  /// \brief Charge allocations of the current thread to a tag while in scope
+  class ARROW_EXPORT ScopedTag {
+   public:
+    explicit ScopedTag(int tag);
+    ~ScopedTag();
+
+   private:
+    int previous_tag_;
+  };
+
+ private:
+  void RecordSize(int64_t size);
+
+  MemoryPool* parent_;
+  const bool track_tags_;
+
+  std::atomic<int64_t> bytes_allocated_;
+  std::atomic<int64_t> max_memory_;
+  std::atomic<int64_t> num_allocations_;
+  std::atomic<int64_t> num_reallocations_;
+  std::atomic<int64_t> num_reallocation_copies_;
+  std::atomic<int64_t> num_frees_;
+  std::atomic<int64_t> allocate_nanos_;
+  std::atomic<int64_t> reallocate_nanos_;
+  std::atomic<int64_t> free_nanos_;
+  std::atomic<int64_t> size_histogram_[kNumSizeBuckets];
+  std::atomic<int64_t> bytes_by_tag_[kMaxTags];
+};
+
+/// \brief A memory pool that forwards to a parent pool and accounts for the
+/// memory allocated through it on its own
+///
+/// Proxy pools can be stacked to form a tree, e.g. one pool per query on top
+/// of a process-wide pool. Each pool tracks its own usage and peak, and may
+/// enforce a hard limit: a request that would push the pool above its limit
+/// fails with Status::OutOfMemory without reaching the parent pool. All
+/// statistics are atomics and can be read while allocations are in flight.
+class ARROW_EXPORT ProxyMemoryPool : public MemoryPool {
+ public:
+  /// \param[in] parent the pool to allocate from, the default pool if null
+  /// \param[in] limit the maximum number of bytes allocated at any time, or -1
+  ///   for no limit
+  explicit ProxyMemoryPool(MemoryPool* parent = nullptr, int64_t limit = -1);
+  virtual ~ProxyMemoryPool();
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  MemoryPool* parent() const { return parent_; }
+
+  /// The byte limit of this pool, -1 if unlimited
+  int64_t limit() const { return limit_; }
+
+  /// The number of requests rejected because of the limit
+  int64_t num_rejected() const;
+
+ private:
+  // Account for size more bytes, failing if the limit would be exceeded
+  Status Reserve(int64_t size);
+
+  MemoryPool* parent_;
+  const int64_t limit_;
+
+  std::atomic<int64_t> bytes_allocated_;
+  std::atomic<int64_t> max_memory_;
+  std::atomic<int64_t> num_rejected_;
+};
+
+/// \brief A memory pool that backs large allocations with huge pages
+///
+/// Allocations of at least huge_page_threshold bytes are mapped directly from
+/// the operating system, aligned to 2 MB and advised to use transparent huge
+/// pages (or, optionally, explicit pages from hugetlbfs), which reduces TLB
+/// misses when scanning large column buffers. The mappings can be bound to a
+/// NUMA node. Smaller allocations use the same allocator as DefaultMemoryPool.
+///
+/// Huge pages and NUMA binding are only available on Linux; elsewhere this
+/// behaves like DefaultMemoryPool.
+class ARROW_EXPORT HugePageMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kHugePageSize = 2 << 20;
+
+  /// \param[in] numa_node the NUMA node to bind large allocations to, or -1
+  ///   to use the default placement policy
+  /// \param[in] use_hugetlb try explicit huge pages first; this requires pages
+  ///   to be reserved through vm.nr_hugepages
+  /// \param[in] huge_page_threshold the minimum size of allocations that are
+  ///   mapped with huge pages
+  explicit HugePageMemoryPool(int numa_node = -1, bool use_hugetlb = false,
+      int64_t huge_page_threshold = kHugePageSize);
+  virtual ~HugePageMemoryPool();
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  int numa_node() const { return numa_node_; }
+
+ private:
+  bool IsMapped(int64_t size) const { return size >= huge_page_threshold_; }
+
+  Status MapHugePages(int64_t size, uint8_t** out);
+  void UnmapHugePages(uint8_t* buffer, int64_t size);
+
+  const int numa_node_;
+  const bool use_hugetlb_;
+  const int64_t huge_page_threshold_;
+
+  std::atomic<int64_t> bytes_allocated_;
+  std::atomic<int64_t> max_memory_;
+};
+
+/// \brief A memory pool that caches freed blocks in per-thread free lists
+///
+/// Small allocations are rounded up to power-of-two size classes (64 bytes
+/// up to 64 KB) and served from a free list private to the calling thread, so
+/// that threads allocating concurrently do not contend on a shared lock.
+/// Larger allocations go straight to the system allocator. Memory freed on a
+/// thread is cached by that thread, regardless of where it was allocated.
+///
+/// The shared byte counters are updated in batches. bytes_allocated() is exact
+/// once all threads are quiescent; while allocations are in flight on other
+/// threads, it and max_memory() may be off by up to about 1 MB per thread.
+class ARROW_EXPORT ThreadCachingMemoryPool : public MemoryPool {
+ public:
+  ThreadCachingMemoryPool();
+  virtual ~ThreadCachingMemoryPool();
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// Return all blocks cached by the calling thread to the system allocator
+  void ReleaseThreadCache();
+
+ private:
+  class ARROW_NO_EXPORT ThreadCachingMemoryPoolImpl;
+  std::shared_ptr<ThreadCachingMemoryPoolImpl> impl_;
+};
+
+/// \brief A bump-pointer memory pool for short-lived allocations
+///
+/// Allocations are carved as 64-byte aligned slices out of large chunks
+/// obtained from a parent pool. Free() only updates the statistics; memory is
+/// reclaimed all at once by Reset(), which keeps the chunks around for reuse.
+/// Reallocating the most recent allocation grows or shrinks it in place when
+/// the current chunk has room.
+///
+/// Requests larger than the chunk size get a dedicated block from the parent
+/// pool, which is returned on Reset().
+class ARROW_EXPORT ArenaMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kDefaultChunkSize = 1 << 20;
+
+  explicit ArenaMemoryPool(
+      MemoryPool* parent = nullptr, int64_t chunk_size = kDefaultChunkSize);
+  virtual ~ArenaMemoryPool();
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// Make all memory handed out so far available again. Any buffer
+  /// allocated from this pool must not be accessed after calling this.
+  void Reset();
+
+  /// The number of bytes currently held from the parent pool
+  int64_t bytes_reserved() const;
+
+ private:
+  struct Chunk {
+    uint8_t* data;
+    int64_t size;
+  };
+
+  Status NextChunk();
+
+  MemoryPool* parent_;
+  const int64_t chunk_size_;
+
+  mutable std::mutex lock_;
+  std::vector<Chunk> chunks_;
+  std::vector<Chunk> large_blocks_;
+  // Index into chunks_ of the chunk being carved, -1 if none yet
+  int64_t current_chunk_;
+  int64_t position_;
+  uint8_t* last_allocation_;
+
+  int64_t bytes_allocated_;
+  int64_t max_memory_;
+};
+
 ARROW_EXPORT MemoryPool* default_memory_pool();
 
 }  // namespace arrow
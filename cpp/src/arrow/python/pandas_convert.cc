@@ -96,14 +96,19 @@ static int64_t ValuesToBitmap(PyArrayObject* arr, uint8_t* bitmap) {
   int64_t null_count = 0;
 
   Ndarray1DIndexer<T> values(arr);
-
-  // TODO(wesm): striding
-  for (int i = 0; i < values.size(); ++i) {
-    if (traits::isnull(values[i])) {
-      ++null_count;
-    } else {
-      BitUtil::SetBit(bitmap, i);
+  const int64_t length = values.size();
+
+  // Compute the validity of a chunk at a time into a byte mask, which the
+  // vectorized kernel then packs into the bitmap
+  constexpr int64_t kChunkSize = 1024;
+  uint8_t valid_bytes[kChunkSize];
+  for (int64_t offset = 0; offset < length; offset += kChunkSize) {
+    const int64_t chunk_length = std::min(kChunkSize, length - offset);
+    for (int64_t i = 0; i < chunk_length; ++i) {
+      valid_bytes[i] = !traits::isnull(values[offset + i]);
     }
+    null_count +=
+        chunk_length - BitUtil::BytesToBitmap(valid_bytes, chunk_length, bitmap, offset);
   }
 
   return null_count;
@@ -111,6 +116,12 @@ static int64_t ValuesToBitmap(PyArrayObject* arr, uint8_t* bitmap) {
 
 // Returns null count
 static int64_t MaskToBitmap(PyArrayObject* mask, int64_t length, uint8_t* bitmap) {
+  if (PyArray_STRIDES(mask)[0] == sizeof(uint8_t)) {
+    // The mask is set for nulls, so the bitmap takes its inverse
+    const uint8_t* mask_values = reinterpret_cast<const uint8_t*>(PyArray_DATA(mask));
+    return length - BitUtil::BytesToBitmap(mask_values, length, bitmap, 0, true);
+  }
+
   int64_t null_count = 0;
 
   Ndarray1DIndexer<uint8_t> mask_values(mask);
@@ -488,8 +499,13 @@ inline Status PandasConverter::ConvertData<BooleanType>(std::shared_ptr<Buffer>*
   uint8_t* bitmap = buffer->mutable_data();
 
   memset(bitmap, 0, nbytes);
-  for (int i = 0; i < length_; ++i) {
-    if (values[i] > 0) { BitUtil::SetBit(bitmap, i); }
+  if (PyArray_STRIDES(arr_)[0] == sizeof(uint8_t)) {
+    BitUtil::BytesToBitmap(
+        reinterpret_cast<const uint8_t*>(PyArray_DATA(arr_)), length_, bitmap, 0);
+  } else {
+    for (int i = 0; i < length_; ++i) {
+      if (values[i] > 0) { BitUtil::SetBit(bitmap, i); }
+    }
   }
 
   *data = buffer;
@@ -1276,9 +1292,9 @@ static void ConvertBooleanNoNulls(const ChunkedArray& data, uint8_t* out_values)
   for (int c = 0; c < data.num_chunks(); c++) {
     const std::shared_ptr<Array> arr = data.chunk(c);
     auto bool_arr = static_cast<BooleanArray*>(arr.get());
-    for (int64_t i = 0; i < arr->length(); ++i) {
-      *out_values++ = static_cast<uint8_t>(bool_arr->Value(i));
-    }
+    BitUtil::BitmapToBytes(
+        bool_arr->data()->data(), bool_arr->offset(), bool_arr->length(), out_values);
+    out_values += bool_arr->length();
   }
 }
 
@@ -0,0 +1,145 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/memory_pool.h"
+#include "arrow/test-util.h"
+#include "arrow/util/bit-util.h"
+
+namespace arrow {
+
+constexpr int64_t kBitmapLength = 1 << 20;
+
+static std::vector<uint8_t> MakeValidBytes(int64_t length) {
+  std::vector<uint8_t> valid_bytes(length);
+  test::random_null_bytes(length, 0.5, valid_bytes.data());
+  return valid_bytes;
+}
+
+static void BM_BytesToBitmapNaive(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<uint8_t> valid_bytes = MakeValidBytes(kBitmapLength);
+  std::vector<uint8_t> bitmap(kBitmapLength / 8 + 1);
+  const int64_t offset = state.range(0);
+
+  while (state.KeepRunning()) {
+    for (int64_t i = 0; i < kBitmapLength; ++i) {
+      BitUtil::SetBitTo(bitmap.data(), offset + i, valid_bytes[i] != 0);
+    }
+    benchmark::DoNotOptimize(bitmap.data());
+  }
+  state.SetBytesProcessed(state.iterations() * kBitmapLength);
+}
+
+static void BM_BytesToBitmap(benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<uint8_t> valid_bytes = MakeValidBytes(kBitmapLength);
+  std::vector<uint8_t> bitmap(kBitmapLength / 8 + 1);
+  const int64_t offset = state.range(0);
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(BitUtil::BytesToBitmap(
+        valid_bytes.data(), kBitmapLength, bitmap.data(), offset));
+  }
+  state.SetBytesProcessed(state.iterations() * kBitmapLength);
+}
+
+static void BM_BitmapToBytes(benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<uint8_t> valid_bytes = MakeValidBytes(kBitmapLength);
+  std::vector<uint8_t> bitmap(kBitmapLength / 8 + 1);
+  BitUtil::BytesToBitmap(valid_bytes.data(), kBitmapLength, bitmap.data(), 0);
+  std::vector<uint8_t> bytes(kBitmapLength);
+  const int64_t offset = state.range(0);
+
+  while (state.KeepRunning()) {
+    BitUtil::BitmapToBytes(bitmap.data(), offset, kBitmapLength, bytes.data());
+    benchmark::DoNotOptimize(bytes.data());
+  }
+  state.SetBytesProcessed(state.iterations() * kBitmapLength);
+}
+
+static void BM_AppendWithNulls(benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<uint8_t> valid_bytes = MakeValidBytes(kBitmapLength);
+  const std::vector<int64_t> values(kBitmapLength, 100);
+
+  while (state.KeepRunning()) {
+    Int64Builder builder(default_memory_pool());
+    for (int i = 0; i < 16; ++i) {
+      ABORT_NOT_OK(builder.Append(values.data(), kBitmapLength, valid_bytes.data()));
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * 16 * kBitmapLength * sizeof(int64_t));
+}
+
+static void BM_CountSetBits(benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<uint8_t> bitmap(kBitmapLength / 8);
+  test::random_bytes(bitmap.size(), 0, bitmap.data());
+  const int64_t offset = state.range(0);
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(
+        CountSetBits(bitmap.data(), offset, kBitmapLength - offset));
+  }
+  state.SetBytesProcessed(state.iterations() * bitmap.size());
+}
+
+static void BM_BitmapEquals(benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<uint8_t> bitmap(kBitmapLength / 8);
+  test::random_bytes(bitmap.size(), 0, bitmap.data());
+  // Compare the bitmap with a copy of itself at a different bit offset
+  std::shared_ptr<Buffer> copy;
+  const int64_t offset = state.range(0);
+  ABORT_NOT_OK(CopyBitmap(
+      default_memory_pool(), bitmap.data(), offset, kBitmapLength - offset, &copy));
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(BitmapEquals(
+        bitmap.data(), offset, copy->data(), 0, kBitmapLength - offset));
+  }
+  state.SetBytesProcessed(state.iterations() * bitmap.size());
+}
+
+static void BM_BitmapAnd(benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<uint8_t> left(kBitmapLength / 8);
+  std::vector<uint8_t> right(kBitmapLength / 8);
+  test::random_bytes(left.size(), 0, left.data());
+  test::random_bytes(right.size(), 1, right.data());
+  const int64_t offset = state.range(0);
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<Buffer> out;
+    ABORT_NOT_OK(BitmapAnd(default_memory_pool(), left.data(), offset, right.data(), 0,
+        kBitmapLength - offset, &out));
+  }
+  state.SetBytesProcessed(state.iterations() * left.size() * 2);
+}
+
+BENCHMARK(BM_BytesToBitmapNaive)->Arg(0)->Arg(3);
+BENCHMARK(BM_BytesToBitmap)->Arg(0)->Arg(3);
+BENCHMARK(BM_BitmapToBytes)->Arg(0)->Arg(3);
+BENCHMARK(BM_AppendWithNulls)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CountSetBits)->Arg(0)->Arg(3);
+BENCHMARK(BM_BitmapEquals)->Arg(0)->Arg(3);
+BENCHMARK(BM_BitmapAnd)->Arg(0)->Arg(3);
+
+}  // namespace arrow
@@ -15,11 +15,13 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
 #include <limits>
+#include <utility>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -77,6 +79,25 @@ static inline int64_t SlowCountBits(
   return count;
 }
 
+// Run body with the kernels for each subset of the CPU features it has
+template <typename Body>
+static void ForEachKernel(Body&& body) {
+  EnsureCpuInfoInitialized();
+  body();
+  const std::vector<int64_t> features = {CpuInfo::AVX2, CpuInfo::POPCNT};
+  std::vector<int64_t> disabled;
+  for (int64_t feature : features) {
+    if (CpuInfo::IsSupported(feature)) {
+      CpuInfo::EnableFeature(feature, false);
+      disabled.push_back(feature);
+      body();
+    }
+  }
+  for (int64_t feature : disabled) {
+    CpuInfo::EnableFeature(feature, true);
+  }
+}
+
 TEST(BitUtilTests, TestCountSetBits) {
   const int kBufferSize = 1000;
   uint8_t buffer[kBufferSize] = {0};
@@ -87,14 +108,90 @@ TEST(BitUtilTests, TestCountSetBits) {
 
   std::vector<int64_t> offsets = {
       0, 12, 16, 32, 37, 63, 64, 128, num_bits - 30, num_bits - 64};
-  for (int64_t offset : offsets) {
-    int64_t result = CountSetBits(buffer, offset, num_bits - offset);
-    int64_t expected = SlowCountBits(buffer, offset, num_bits - offset);
+  ForEachKernel([&]() {
+    for (int64_t offset : offsets) {
+      int64_t result = CountSetBits(buffer, offset, num_bits - offset);
+      int64_t expected = SlowCountBits(buffer, offset, num_bits - offset);
+
+      ASSERT_EQ(expected, result);
+
+      // Short ranges that end before the next byte or word
+      for (int64_t length : {0, 3, 60, 300}) {
+        length = std::min(length, num_bits - offset);
+        ASSERT_EQ(SlowCountBits(buffer, offset, length),
+            CountSetBits(buffer, offset, length));
+      }
+    }
+  });
+}
 
-    ASSERT_EQ(expected, result);
+TEST(BitUtilTests, TestBitmapEquals) {
+  const int kBufferSize = 1000;
+  const int num_bits = kBufferSize * 8;
+  uint8_t buffer[kBufferSize];
+  test::random_bytes(kBufferSize, 0, buffer);
+
+  std::vector<int64_t> offsets = {0, 5, 8, 37, 64, 101};
+  for (int64_t left_offset : offsets) {
+    for (int64_t right_offset : offsets) {
+      // Copy the bits of left to a different offset in a second bitmap
+      const int64_t length = num_bits - std::max(left_offset, right_offset);
+      std::vector<uint8_t> other(kBufferSize, 0);
+      for (int64_t i = 0; i < length; ++i) {
+        BitUtil::SetBitTo(other.data(), right_offset + i,
+            BitUtil::GetBit(buffer, left_offset + i));
+      }
+      ASSERT_TRUE(BitmapEquals(buffer, left_offset, other.data(), right_offset, length));
+
+      // A difference in the first, a middle or the last bit is detected
+      for (int64_t i : {int64_t(0), length / 2, length - 1}) {
+        const bool bit = BitUtil::GetBit(other.data(), right_offset + i);
+        BitUtil::SetBitTo(other.data(), right_offset + i, !bit);
+        ASSERT_FALSE(
+            BitmapEquals(buffer, left_offset, other.data(), right_offset, length));
+        BitUtil::SetBitTo(other.data(), right_offset + i, bit);
+      }
+    }
   }
 }
 
+TEST(BitUtilTests, TestBitmapAndOr) {
+  const int kBufferSize = 1000;
+  const int num_bits = kBufferSize * 8;
+  uint8_t left[kBufferSize];
+  uint8_t right[kBufferSize];
+  test::random_bytes(kBufferSize, 0, left);
+  test::random_bytes(kBufferSize, 1, right);
+
+  ForEachKernel([&]() {
+    std::vector<std::pair<int64_t, int64_t>> offsets = {
+        {0, 0}, {8, 64}, {3, 3}, {5, 17}, {64, 1}};
+    for (const auto& offset : offsets) {
+      for (int64_t length : {1, 13, 64, 300, num_bits - 64}) {
+        std::shared_ptr<Buffer> and_result, or_result, and_not_result;
+        ASSERT_OK(BitmapAnd(default_memory_pool(), left, offset.first, right,
+            offset.second, length, &and_result));
+        ASSERT_OK(BitmapOr(default_memory_pool(), left, offset.first, right,
+            offset.second, length, &or_result));
+        ASSERT_OK(BitmapAndNot(default_memory_pool(), left, offset.first, right,
+            offset.second, length, &and_not_result));
+
+        for (int64_t i = 0; i < length; ++i) {
+          const bool l = BitUtil::GetBit(left, offset.first + i);
+          const bool r = BitUtil::GetBit(right, offset.second + i);
+          ASSERT_EQ(l && r, BitUtil::GetBit(and_result->data(), i));
+          ASSERT_EQ(l || r, BitUtil::GetBit(or_result->data(), i));
+          ASSERT_EQ(l && !r, BitUtil::GetBit(and_not_result->data(), i));
+        }
+        // Padding bits of the last byte are zero
+        for (int64_t i = length; i < BitUtil::CeilByte(length); ++i) {
+          ASSERT_FALSE(BitUtil::GetBit(or_result->data(), i));
+        }
+      }
+    }
+  });
+}
+
 TEST(BitUtilTests, TestCopyBitmap) {
   const int kBufferSize = 1000;
 
@@ -120,6 +217,68 @@ TEST(BitUtilTests, TestCopyBitmap) {
   }
 }
 
+TEST(BitUtilTests, TestBytesToBitmap) {
+  const int kLength = 1000;
+  std::vector<uint8_t> bytes(kLength);
+  test::random_bytes(kLength, 0, bytes.data());
+  // About a third zeros, and non-zero bytes of every magnitude
+  for (uint8_t& byte : bytes) {
+    if (byte % 3 == 0) { byte = 0; }
+  }
+
+  ForEachKernel([&bytes]() {
+    std::vector<int64_t> offsets = {0, 3, 8, 13, 64, 69};
+    std::vector<int64_t> lengths = {0, 1, 7, 8, 31, 33, 100, kLength - 69};
+    for (bool invert : {false, true}) {
+      for (int64_t offset : offsets) {
+        for (int64_t length : lengths) {
+          // Bits outside the written range must keep their value
+          std::vector<uint8_t> bitmap(kLength / 8 + 2, 0xA5);
+          const std::vector<uint8_t> original = bitmap;
+
+          int64_t result =
+              BitUtil::BytesToBitmap(bytes.data(), length, bitmap.data(), offset, invert);
+
+          int64_t expected = 0;
+          for (int64_t i = 0; i < static_cast<int64_t>(bitmap.size()) * 8; ++i) {
+            if (i >= offset && i < offset + length) {
+              const bool is_set = (bytes[i - offset] != 0) != invert;
+              ASSERT_EQ(is_set, BitUtil::GetBit(bitmap.data(), i)) << i;
+              expected += is_set;
+            } else {
+              ASSERT_EQ(BitUtil::GetBit(original.data(), i),
+                  BitUtil::GetBit(bitmap.data(), i));
+            }
+          }
+          ASSERT_EQ(expected, result);
+        }
+      }
+    }
+  });
+}
+
+TEST(BitUtilTests, TestBitmapToBytes) {
+  const int kBufferSize = 200;
+  uint8_t bitmap[kBufferSize];
+  test::random_bytes(kBufferSize, 0, bitmap);
+
+  ForEachKernel([&bitmap]() {
+    const int64_t num_bits = kBufferSize * 8;
+    std::vector<int64_t> offsets = {0, 5, 8, 37, 64, 100};
+    for (int64_t offset : offsets) {
+      for (int64_t length : {int64_t(0), int64_t(3), int64_t(32), num_bits - offset}) {
+        std::vector<uint8_t> bytes(length + 1, 0xFF);
+        BitUtil::BitmapToBytes(bitmap, offset, length, bytes.data());
+        for (int64_t i = 0; i < length; ++i) {
+          ASSERT_EQ(BitUtil::GetBit(bitmap, offset + i) ? 1 : 0, bytes[i]) << i;
+        }
+        // Nothing is written past the end
+        ASSERT_EQ(0xFF, bytes[length]);
+      }
+    }
+  });
+}
+
 TEST(BitUtil, Ceil) {
   EXPECT_EQ(BitUtil::Ceil(0, 1), 0);
   EXPECT_EQ(BitUtil::Ceil(1, 1), 1);
@@ -171,6 +330,13 @@ TEST(BitUtil, Popcount) {
   EXPECT_EQ(BitUtil::PopcountNoHw(0), 0);
 }
 
+TEST(BitUtil, CountLeadingZeros) {
+  EXPECT_EQ(64, BitUtil::CountLeadingZeros(0));
+  EXPECT_EQ(63, BitUtil::CountLeadingZeros(1));
+  EXPECT_EQ(32, BitUtil::CountLeadingZeros(UINT64_C(0xFFFFFFFF)));
+  EXPECT_EQ(0, BitUtil::CountLeadingZeros(UINT64_C(1) << 63));
+}
+
 TEST(BitUtil, TrailingBits) {
   EXPECT_EQ(BitUtil::TrailingBits(BOOST_BINARY(1 1 1 1 1 1 1 1), 0), 0);
   EXPECT_EQ(BitUtil::TrailingBits(BOOST_BINARY(1 1 1 1 1 1 1 1), 1), 1);
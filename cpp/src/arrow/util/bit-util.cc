@@ -23,6 +23,23 @@
 #define __builtin_popcountll _mm_popcnt_u64
 #endif
 
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define ARROW_HAVE_SSE2
+#endif
+
+// The AVX2 kernels are compiled for that target function by function and only
+// called when CpuInfo reports AVX2 support, so the library itself does not
+// require AVX2. Only 64-bit targets, as the kernels use 64-bit lane extracts.
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define ARROW_HAVE_RUNTIME_AVX2
+#define ARROW_TARGET_AVX2 __attribute__((target("avx2,popcnt")))
+#define ARROW_TARGET_POPCNT __attribute__((target("popcnt")))
+#else
+#define ARROW_TARGET_POPCNT
+#endif
+
 #include <algorithm>
 #include <cstring>
 #include <vector>
@@ -31,9 +48,179 @@
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/bit-util.h"
+#include "arrow/util/cpu-info.h"
 
 namespace arrow {
 
+namespace {
+
+bool InitCpuInfo() {
+  CpuInfo::Init();
+  return true;
+}
+
+// Kernels are selected per call so that tests can toggle CpuInfo features
+inline bool CpuSupports(int64_t flag) {
+  static const bool cpu_info_initialized = InitCpuInfo();
+  return cpu_info_initialized && CpuInfo::IsSupported(flag);
+}
+
+inline bool UseAvx2() {
+  return CpuSupports(CpuInfo::AVX2);
+}
+
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+
+// Pack 32 bytes at a time; length must be a multiple of 32
+ARROW_TARGET_AVX2 int64_t PackBytesAvx2(
+    const uint8_t* bytes, int64_t length, uint8_t* bits, bool invert) {
+  const __m256i zero = _mm256_setzero_si256();
+  // The comparison with zero yields the bits of the zero bytes
+  const uint32_t flip = invert ? 0 : 0xFFFFFFFF;
+  int64_t count = 0;
+  for (int64_t i = 0; i < length; i += 32) {
+    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + i));
+    const uint32_t mask =
+        static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, zero))) ^ flip;
+    memcpy(bits + i / 8, &mask, sizeof(mask));
+    count += __builtin_popcount(mask);
+  }
+  return count;
+}
+
+// Unpack 4 bitmap bytes at a time; nbytes must be a multiple of 4
+ARROW_TARGET_AVX2 void UnpackBitsAvx2(
+    const uint8_t* bits, int64_t nbytes, uint8_t* bytes) {
+  // Output byte j takes bitmap byte j / 8, then tests bit j % 8 of it
+  const __m256i shuffle = _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+      1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3);
+  const __m256i bit_mask =
+      _mm256_set1_epi64x(static_cast<int64_t>(0x8040201008040201ULL));
+  const __m256i ones = _mm256_set1_epi8(1);
+  for (int64_t i = 0; i < nbytes; i += 4) {
+    uint32_t word;
+    memcpy(&word, bits + i, sizeof(word));
+    __m256i v =
+        _mm256_shuffle_epi8(_mm256_set1_epi32(static_cast<int32_t>(word)), shuffle);
+    v = _mm256_cmpeq_epi8(_mm256_and_si256(v, bit_mask), bit_mask);
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(bytes + i * 8), _mm256_and_si256(v, ones));
+  }
+}
+
+#endif  // ARROW_HAVE_RUNTIME_AVX2
+
+#ifdef ARROW_HAVE_SSE2
+
+// Pack 16 bytes at a time; length must be a multiple of 16
+int64_t PackBytesSse2(const uint8_t* bytes, int64_t length, uint8_t* bits, bool invert) {
+  const __m128i zero = _mm_setzero_si128();
+  const uint32_t flip = invert ? 0 : 0xFFFF;
+  int64_t count = 0;
+  for (int64_t i = 0; i < length; i += 16) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+    const uint32_t mask =
+        static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, zero))) ^ flip;
+    bits[i / 8] = static_cast<uint8_t>(mask);
+    bits[i / 8 + 1] = static_cast<uint8_t>(mask >> 8);
+    count += __builtin_popcount(mask);
+  }
+  return count;
+}
+
+#endif  // ARROW_HAVE_SSE2
+
+// Pack bytes into whole bitmap bytes; length must be a multiple of 8
+int64_t PackBytes(const uint8_t* bytes, int64_t length, uint8_t* bits, bool invert) {
+  int64_t count = 0;
+  int64_t i = 0;
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+  if (UseAvx2()) {
+    const int64_t avx2_length = length - length % 32;
+    count += PackBytesAvx2(bytes, avx2_length, bits, invert);
+    i = avx2_length;
+  }
+#endif
+#ifdef ARROW_HAVE_SSE2
+  const int64_t sse2_length = (length - i) - (length - i) % 16;
+  count += PackBytesSse2(bytes + i, sse2_length, bits + i / 8, invert);
+  i += sse2_length;
+#endif
+  for (; i < length; i += 8) {
+    uint8_t byte = 0;
+    for (int j = 0; j < 8; ++j) {
+      byte = static_cast<uint8_t>(byte | ((bytes[i + j] != 0) << j));
+    }
+    if (invert) { byte = static_cast<uint8_t>(~byte); }
+    bits[i / 8] = byte;
+    count += __builtin_popcount(byte);
+  }
+  return count;
+}
+
+// Unpack whole bitmap bytes into 8 bytes each
+void UnpackBits(const uint8_t* bits, int64_t nbytes, uint8_t* bytes) {
+  int64_t i = 0;
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+  if (UseAvx2()) {
+    i = nbytes - nbytes % 4;
+    UnpackBitsAvx2(bits, i, bytes);
+  }
+#endif
+  for (; i < nbytes; ++i) {
+    // The multiplication moves bit k of the low seven bits to bit 0 of byte k
+    // without carries; the top bit would collide, so it is placed separately
+    uint64_t spread =
+        ((static_cast<uint64_t>(bits[i] & 0x7F) * 0x0002040810204081ULL) &
+            0x0101010101010101ULL) |
+        (static_cast<uint64_t>(bits[i] >> 7) << 56);
+#if __BYTE_ORDER != __LITTLE_ENDIAN
+    spread = BitUtil::ByteSwap(spread);
+#endif
+    memcpy(bytes + i * 8, &spread, sizeof(spread));
+  }
+}
+
+}  // namespace
+
+int64_t BitUtil::BytesToBitmap(const uint8_t* bytes, int64_t length, uint8_t* bitmap,
+    int64_t bit_offset, bool invert) {
+  int64_t count = 0;
+  int64_t i = 0;
+
+  // Bits up to the first byte boundary in the bitmap
+  for (; i < length && (bit_offset + i) % 8 != 0; ++i) {
+    const bool is_set = (bytes[i] != 0) != invert;
+    BitUtil::SetBitTo(bitmap, bit_offset + i, is_set);
+    count += is_set;
+  }
+
+  const int64_t whole_length = (length - i) / 8 * 8;
+  count += PackBytes(bytes + i, whole_length, bitmap + (bit_offset + i) / 8, invert);
+
+  for (i += whole_length; i < length; ++i) {
+    const bool is_set = (bytes[i] != 0) != invert;
+    BitUtil::SetBitTo(bitmap, bit_offset + i, is_set);
+    count += is_set;
+  }
+  return count;
+}
+
+void BitUtil::BitmapToBytes(
+    const uint8_t* bitmap, int64_t bit_offset, int64_t length, uint8_t* bytes) {
+  int64_t i = 0;
+  for (; i < length && (bit_offset + i) % 8 != 0; ++i) {
+    bytes[i] = BitUtil::GetBit(bitmap, bit_offset + i);
+  }
+
+  const int64_t whole_bytes = (length - i) / 8;
+  UnpackBits(bitmap + (bit_offset + i) / 8, whole_bytes, bytes + i);
+
+  for (i += whole_bytes * 8; i < length; ++i) {
+    bytes[i] = BitUtil::GetBit(bitmap, bit_offset + i);
+  }
+}
+
 void BitUtil::FillBitsFromBytes(const std::vector<uint8_t>& bytes, uint8_t* bits) {
   for (size_t i = 0; i < bytes.size(); ++i) {
     if (bytes[i] > 0) { SetBit(bits, i); }
@@ -48,49 +235,172 @@ Status BitUtil::BytesToBits(
   RETURN_NOT_OK(AllocateBuffer(default_memory_pool(), bit_length, &buffer));
 
   memset(buffer->mutable_data(), 0, static_cast<size_t>(bit_length));
-  FillBitsFromBytes(bytes, buffer->mutable_data());
+  BytesToBitmap(bytes.data(), static_cast<int64_t>(bytes.size()),
+      buffer->mutable_data(), 0);
 
   *out = buffer;
   return Status::OK();
 }
 
-int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
-  constexpr int64_t pop_len = sizeof(uint64_t) * 8;
+namespace {
 
-  int64_t count = 0;
+// Load the 64 bits starting at bit_offset, touching only the bytes that hold them
+inline uint64_t LoadWord(const uint8_t* bitmap, int64_t bit_offset) {
+  const uint8_t* bytes = bitmap + bit_offset / 8;
+  const int shift = static_cast<int>(bit_offset % 8);
+  uint64_t word;
+  memcpy(&word, bytes, sizeof(word));
+#if __BYTE_ORDER != __LITTLE_ENDIAN
+  word = BitUtil::ByteSwap(word);
+#endif
+  if (shift != 0) {
+    word = (word >> shift) | (static_cast<uint64_t>(bytes[8]) << (64 - shift));
+  }
+  return word;
+}
+
+inline void StoreWord(uint64_t word, uint8_t* bytes) {
+#if __BYTE_ORDER != __LITTLE_ENDIAN
+  word = BitUtil::ByteSwap(word);
+#endif
+  memcpy(bytes, &word, sizeof(word));
+}
+
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+
+// Count the bits of each 64-bit lane with a nibble lookup table
+ARROW_TARGET_AVX2 inline __m256i PopcountLanes(__m256i v) {
+  const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3,
+      4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+  const __m256i low_mask = _mm256_set1_epi8(0x0F);
+  const __m256i lo = _mm256_and_si256(v, low_mask);
+  const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+  const __m256i counts = _mm256_add_epi8(
+      _mm256_shuffle_epi8(lookup, lo), _mm256_shuffle_epi8(lookup, hi));
+  return _mm256_sad_epu8(counts, _mm256_setzero_si256());
+}
+
+// Carry-save adder: h:l = a + b + c, bitwise
+ARROW_TARGET_AVX2 inline void CarrySaveAdd(
+    __m256i* h, __m256i* l, __m256i a, __m256i b, __m256i c) {
+  const __m256i u = _mm256_xor_si256(a, b);
+  *h = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(u, c));
+  *l = _mm256_xor_si256(u, c);
+}
+
+ARROW_TARGET_AVX2 inline __m256i Load256(const uint8_t* data, int64_t i) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data) + i);
+}
 
-  // The first bit offset where we can use a 64-bit wide hardware popcount
-  const int64_t fast_count_start = BitUtil::RoundUp(bit_offset, pop_len);
+// Harley-Seal popcount over num_blocks 32-byte blocks: a tree of carry-save
+// adders reduces 16 blocks to one, so only one in 16 blocks needs a full
+// popcount
+ARROW_TARGET_AVX2 int64_t PopcountAvx2(const uint8_t* data, int64_t num_blocks) {
+  __m256i total = _mm256_setzero_si256();
+  __m256i ones = _mm256_setzero_si256();
+  __m256i twos = _mm256_setzero_si256();
+  __m256i fours = _mm256_setzero_si256();
+  __m256i eights = _mm256_setzero_si256();
+  __m256i sixteens, twos_a, twos_b, fours_a, fours_b, eights_a, eights_b;
 
-  // The number of bits until fast_count_start
-  const int64_t initial_bits = std::min(length, fast_count_start - bit_offset);
-  for (int64_t i = bit_offset; i < bit_offset + initial_bits; ++i) {
-    if (BitUtil::GetBit(data, i)) { ++count; }
+  int64_t i = 0;
+  for (; i + 16 <= num_blocks; i += 16) {
+    CarrySaveAdd(&twos_a, &ones, ones, Load256(data, i), Load256(data, i + 1));
+    CarrySaveAdd(&twos_b, &ones, ones, Load256(data, i + 2), Load256(data, i + 3));
+    CarrySaveAdd(&fours_a, &twos, twos, twos_a, twos_b);
+    CarrySaveAdd(&twos_a, &ones, ones, Load256(data, i + 4), Load256(data, i + 5));
+    CarrySaveAdd(&twos_b, &ones, ones, Load256(data, i + 6), Load256(data, i + 7));
+    CarrySaveAdd(&fours_b, &twos, twos, twos_a, twos_b);
+    CarrySaveAdd(&eights_a, &fours, fours, fours_a, fours_b);
+    CarrySaveAdd(&twos_a, &ones, ones, Load256(data, i + 8), Load256(data, i + 9));
+    CarrySaveAdd(&twos_b, &ones, ones, Load256(data, i + 10), Load256(data, i + 11));
+    CarrySaveAdd(&fours_a, &twos, twos, twos_a, twos_b);
+    CarrySaveAdd(&twos_a, &ones, ones, Load256(data, i + 12), Load256(data, i + 13));
+    CarrySaveAdd(&twos_b, &ones, ones, Load256(data, i + 14), Load256(data, i + 15));
+    CarrySaveAdd(&fours_b, &twos, twos, twos_a, twos_b);
+    CarrySaveAdd(&eights_b, &fours, fours, fours_a, fours_b);
+    CarrySaveAdd(&sixteens, &eights, eights, eights_a, eights_b);
+    total = _mm256_add_epi64(total, PopcountLanes(sixteens));
   }
 
-  const int64_t fast_counts = (length - initial_bits) / pop_len;
+  total = _mm256_slli_epi64(total, 4);
+  total = _mm256_add_epi64(total, _mm256_slli_epi64(PopcountLanes(eights), 3));
+  total = _mm256_add_epi64(total, _mm256_slli_epi64(PopcountLanes(fours), 2));
+  total = _mm256_add_epi64(total, _mm256_slli_epi64(PopcountLanes(twos), 1));
+  total = _mm256_add_epi64(total, PopcountLanes(ones));
+  for (; i < num_blocks; ++i) {
+    total = _mm256_add_epi64(total, PopcountLanes(Load256(data, i)));
+  }
 
-  // Advance until the first aligned 8-byte word after the initial bits
-  const uint64_t* u64_data =
-      reinterpret_cast<const uint64_t*>(data) + fast_count_start / pop_len;
+  return _mm256_extract_epi64(total, 0) + _mm256_extract_epi64(total, 1) +
+         _mm256_extract_epi64(total, 2) + _mm256_extract_epi64(total, 3);
+}
 
-  const uint64_t* end = u64_data + fast_counts;
+#endif  // ARROW_HAVE_RUNTIME_AVX2
 
-  // popcount as much as possible with the widest possible count
-  for (auto iter = u64_data; iter < end; ++iter) {
-    count += __builtin_popcountll(*iter);
+ARROW_TARGET_POPCNT int64_t PopcountWordsHw(const uint8_t* data, int64_t num_words) {
+  int64_t count = 0;
+  for (int64_t i = 0; i < num_words; ++i) {
+    uint64_t word;
+    memcpy(&word, data + i * 8, sizeof(word));
+    count += __builtin_popcountll(word);
   }
+  return count;
+}
 
-  // Account for left over bit (in theory we could fall back to smaller
-  // versions of popcount but the code complexity is likely not worth it)
-  const int64_t tail_index = bit_offset + initial_bits + fast_counts * pop_len;
-  for (int64_t i = tail_index; i < bit_offset + length; ++i) {
-    if (BitUtil::GetBit(data, i)) { ++count; }
+int64_t PopcountWords(const uint8_t* data, int64_t num_words) {
+  int64_t count = 0;
+  for (int64_t i = 0; i < num_words; ++i) {
+    uint64_t word;
+    memcpy(&word, data + i * 8, sizeof(word));
+    count += __builtin_popcountll(word);
   }
+  return count;
+}
 
+// Count the set bits of nbytes whole bytes
+int64_t PopcountBytes(const uint8_t* data, int64_t nbytes) {
+  int64_t count = 0;
+  int64_t i = 0;
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+  if (UseAvx2()) {
+    const int64_t num_blocks = nbytes / 32;
+    count += PopcountAvx2(data, num_blocks);
+    i = num_blocks * 32;
+  }
+#endif
+  const int64_t num_words = (nbytes - i) / 8;
+  if (CpuSupports(CpuInfo::POPCNT)) {
+    count += PopcountWordsHw(data + i, num_words);
+  } else {
+    count += PopcountWords(data + i, num_words);
+  }
+  for (i += num_words * 8; i < nbytes; ++i) {
+    count += __builtin_popcount(data[i]);
+  }
   return count;
 }
 
+}  // namespace
+
+int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
+  int64_t count = 0;
+
+  // Bits up to the first byte boundary, which is all the unaligned handling
+  // needed since the bulk of the bitmap is counted a byte at a time or wider
+  int64_t i = 0;
+  for (; i < length && (bit_offset + i) % 8 != 0; ++i) {
+    count += BitUtil::GetBit(data, bit_offset + i);
+  }
+
+  const int64_t nbytes = (length - i) / 8;
+  count += PopcountBytes(data + (bit_offset + i) / 8, nbytes);
+
+  for (i += nbytes * 8; i < length; ++i) {
+    count += BitUtil::GetBit(data, bit_offset + i);
+  }
+  return count;
+}
 Status GetEmptyBitmap(
     MemoryPool* pool, int64_t length, std::shared_ptr<MutableBuffer>* result) {
   RETURN_NOT_OK(AllocateBuffer(pool, BitUtil::BytesForBits(length), result));
@@ -112,22 +422,23 @@ Status CopyBitmap(MemoryPool* pool, const uint8_t* data, int64_t offset, int64_t
 
 bool BitmapEquals(const uint8_t* left, int64_t left_offset, const uint8_t* right,
     int64_t right_offset, int64_t bit_length) {
+  int64_t i = 0;
   if (left_offset % 8 == 0 && right_offset % 8 == 0) {
     // byte aligned, can use memcmp
-    bool bytes_equal = std::memcmp(left + left_offset / 8, right + right_offset / 8,
-                           bit_length / 8) == 0;
-    if (!bytes_equal) { return false; }
-    for (int64_t i = (bit_length / 8) * 8; i < bit_length; ++i) {
-      if (BitUtil::GetBit(left, left_offset + i) !=
-          BitUtil::GetBit(right, right_offset + i)) {
+    if (std::memcmp(left + left_offset / 8, right + right_offset / 8, bit_length / 8)) {
+      return false;
+    }
+    i = bit_length / 8 * 8;
+  } else {
+    // Compare a word at a time, shifting each side into place
+    for (; i + 64 <= bit_length; i += 64) {
+      if (LoadWord(left, left_offset + i) != LoadWord(right, right_offset + i)) {
         return false;
       }
     }
-    return true;
   }
 
-  // Unaligned slow case
-  for (int64_t i = 0; i < bit_length; ++i) {
+  for (; i < bit_length; ++i) {
     if (BitUtil::GetBit(left, left_offset + i) !=
         BitUtil::GetBit(right, right_offset + i)) {
       return false;
@@ -136,4 +447,112 @@ bool BitmapEquals(const uint8_t* left, int64_t left_offset, const uint8_t* right
   return true;
 }
 
+namespace {
+
+struct BitmapAndOp {
+  static uint64_t Call(uint64_t left, uint64_t right) { return left & right; }
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+  ARROW_TARGET_AVX2 static __m256i Call(__m256i left, __m256i right) {
+    return _mm256_and_si256(left, right);
+  }
+#endif
+};
+
+struct BitmapOrOp {
+  static uint64_t Call(uint64_t left, uint64_t right) { return left | right; }
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+  ARROW_TARGET_AVX2 static __m256i Call(__m256i left, __m256i right) {
+    return _mm256_or_si256(left, right);
+  }
+#endif
+};
+
+struct BitmapAndNotOp {
+  static uint64_t Call(uint64_t left, uint64_t right) { return left & ~right; }
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+  ARROW_TARGET_AVX2 static __m256i Call(__m256i left, __m256i right) {
+    return _mm256_andnot_si256(right, left);
+  }
+#endif
+};
+
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+
+// Apply Op to num_blocks 32-byte blocks
+template <typename Op>
+ARROW_TARGET_AVX2 void BitmapOpAvx2(
+    const uint8_t* left, const uint8_t* right, int64_t num_blocks, uint8_t* out) {
+  for (int64_t i = 0; i < num_blocks; ++i) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out) + i,
+        Op::Call(Load256(left, i), Load256(right, i)));
+  }
+}
+
+#endif  // ARROW_HAVE_RUNTIME_AVX2
+
+template <typename Op>
+Status BitmapOp(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+    const uint8_t* right, int64_t right_offset, int64_t length,
+    std::shared_ptr<Buffer>* out) {
+  const int64_t nbytes = BitUtil::BytesForBits(length);
+  std::shared_ptr<MutableBuffer> buffer;
+  RETURN_NOT_OK(AllocateBuffer(pool, nbytes, &buffer));
+  uint8_t* out_data = buffer->mutable_data();
+
+  int64_t i = 0;
+  if (left_offset % 8 == 0 && right_offset % 8 == 0) {
+    left += left_offset / 8;
+    right += right_offset / 8;
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+    if (UseAvx2()) {
+      const int64_t num_blocks = length / 256;
+      BitmapOpAvx2<Op>(left, right, num_blocks, out_data);
+      i = num_blocks * 256;
+    }
+#endif
+    for (; i + 64 <= length; i += 64) {
+      StoreWord(Op::Call(LoadWord(left, i), LoadWord(right, i)), out_data + i / 8);
+    }
+    left_offset = right_offset = 0;
+  } else {
+    for (; i + 64 <= length; i += 64) {
+      StoreWord(Op::Call(LoadWord(left, left_offset + i),
+                    LoadWord(right, right_offset + i)),
+          out_data + i / 8);
+    }
+  }
+
+  // Remaining bits, with the padding of the last byte zeroed
+  if (i < length) { out_data[nbytes - 1] = 0; }
+  for (; i < length; ++i) {
+    const uint64_t bit = Op::Call(BitUtil::GetBit(left, left_offset + i),
+        BitUtil::GetBit(right, right_offset + i));
+    BitUtil::SetBitTo(out_data, i, (bit & 1) != 0);
+  }
+
+  *out = buffer;
+  return Status::OK();
+}
+
+}  // namespace
+
+Status BitmapAnd(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+    const uint8_t* right, int64_t right_offset, int64_t length,
+    std::shared_ptr<Buffer>* out) {
+  return BitmapOp<BitmapAndOp>(
+      pool, left, left_offset, right, right_offset, length, out);
+}
+
+Status BitmapOr(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+    const uint8_t* right, int64_t right_offset, int64_t length,
+    std::shared_ptr<Buffer>* out) {
+  return BitmapOp<BitmapOrOp>(pool, left, left_offset, right, right_offset, length, out);
+}
+
+Status BitmapAndNot(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+    const uint8_t* right, int64_t right_offset, int64_t length,
+    std::shared_ptr<Buffer>* out) {
+  return BitmapOp<BitmapAndNotOp>(
+      pool, left, left_offset, right, right_offset, length, out);
+}
 }  // namespace arrow
@@ -27,6 +27,7 @@
 #endif
 
 #if defined(_MSC_VER)
+#include <intrin.h>
 #define ARROW_BYTE_SWAP64 _byteswap_uint64
 #define ARROW_BYTE_SWAP32 _byteswap_ulong
 #else
@@ -285,6 +286,18 @@ static inline uint64_t TrailingBits(uint64_t v, int num_bits) {
   return (v << n) >> n;
 }
 
+/// Returns the number of leading zero bits in x, 64 if x is zero
+static inline int CountLeadingZeros(uint64_t x) {
+  if (x == 0) return 64;
+#if defined(_MSC_VER)
+  unsigned long index;  // NOLINT
+  _BitScanReverse64(&index, x);
+  return 63 - static_cast<int>(index);
+#else
+  return __builtin_clzll(x);
+#endif
+}
+
 /// Returns ceil(log2(x)).
 /// TODO: this could be faster if we use __builtin_clz.  Fix this if this ever shows up
 /// in a hot path.
@@ -441,6 +454,21 @@ static T ShiftRightLogical(T v, int shift) {
   return static_cast<typename make_unsigned<T>::type>(v) >> shift;
 }
 
+/// \brief Pack a byte mask into a bitmap
+///
+/// Writes bits [bit_offset, bit_offset + length) of bitmap, leaving the other
+/// bits unchanged. Bit i is set when bytes[i] is non-zero or, if invert is
+/// true, when it is zero. Uses SSE2 or, when the CPU supports it, AVX2.
+///
+/// \return the number of bits set
+ARROW_EXPORT int64_t BytesToBitmap(const uint8_t* bytes, int64_t length,
+    uint8_t* bitmap, int64_t bit_offset, bool invert = false);
+
+/// \brief Unpack bits [bit_offset, bit_offset + length) of bitmap into bytes
+/// that are 1 where the bit is set and 0 otherwise
+ARROW_EXPORT void BitmapToBytes(
+    const uint8_t* bitmap, int64_t bit_offset, int64_t length, uint8_t* bytes);
+
 void FillBitsFromBytes(const std::vector<uint8_t>& bytes, uint8_t* bits);
 ARROW_EXPORT Status BytesToBits(const std::vector<uint8_t>&, std::shared_ptr<Buffer>*);
 
@@ -474,8 +502,35 @@ Status ARROW_EXPORT CopyBitmap(MemoryPool* pool, const uint8_t* bitmap, int64_t
 int64_t ARROW_EXPORT CountSetBits(
     const uint8_t* data, int64_t bit_offset, int64_t length);
 
+/// Return true if the bit ranges of the two bitmaps are equal. The offsets
+/// need not be byte-aligned.
 bool ARROW_EXPORT BitmapEquals(const uint8_t* left, int64_t left_offset,
     const uint8_t* right, int64_t right_offset, int64_t bit_length);
+
+/// Compute the bitwise AND of two bit ranges into a new bitmap
+///
+/// \param[in] pool memory pool to allocate memory from
+/// \param[in] left first bitmap
+/// \param[in] left_offset bit offset into left
+/// \param[in] right second bitmap
+/// \param[in] right_offset bit offset into right
+/// \param[in] length number of bits to combine
+/// \param[out] out the resulting bitmap, starting at bit 0
+///
+/// \return Status message
+Status ARROW_EXPORT BitmapAnd(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+    const uint8_t* right, int64_t right_offset, int64_t length,
+    std::shared_ptr<Buffer>* out);
+
+/// Compute the bitwise OR of two bit ranges into a new bitmap, see BitmapAnd
+Status ARROW_EXPORT BitmapOr(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+    const uint8_t* right, int64_t right_offset, int64_t length,
+    std::shared_ptr<Buffer>* out);
+
+/// Compute left AND NOT right of two bit ranges into a new bitmap, see BitmapAnd
+Status ARROW_EXPORT BitmapAndNot(MemoryPool* pool, const uint8_t* left,
+    int64_t left_offset, const uint8_t* right, int64_t right_offset, int64_t length,
+    std::shared_ptr<Buffer>* out);
 }  // namespace arrow
 
 #endif  // ARROW_UTIL_BIT_UTIL_H
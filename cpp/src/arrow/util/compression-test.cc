@@ -16,10 +16,16 @@
 // under the License.
 
 #include <cstdint>
+#include <cstring>
 #include <gtest/gtest.h>
+#include <lz4frame.h>
+#include <memory>
 #include <string>
 #include <vector>
+#include <zstd.h>
 
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/test-common.h"
 #include "arrow/util/compression.h"
@@ -94,4 +100,125 @@ TEST(TestCompressors, Lz4) {
   CheckCodec<Lz4Codec>();
 }
 
+// Random bytes repeated, so that all codecs shrink them
+static vector<uint8_t> MakeCompressibleData(int64_t size) {
+  vector<uint8_t> pattern(1000);
+  test::random_bytes(pattern.size(), 0, pattern.data());
+  vector<uint8_t> data(size);
+  for (int64_t i = 0; i < size; ++i) {
+    data[i] = pattern[i % pattern.size()];
+  }
+  return data;
+}
+
+static void CheckFramesRoundtrip(Compression::type compression,
+    const vector<uint8_t>& data, int64_t block_size, int num_threads,
+    std::shared_ptr<Buffer>* compressed = nullptr) {
+  std::shared_ptr<Buffer> out;
+  CompressedFrames frames;
+  ASSERT_OK(CompressFrames(compression, data.size(), data.data(), block_size,
+      num_threads, default_memory_pool(), &out, &frames));
+
+  const int64_t num_frames =
+      (static_cast<int64_t>(data.size()) + block_size - 1) / block_size;
+  ASSERT_EQ(num_frames, frames.num_frames());
+  ASSERT_EQ(0, frames.offsets.front());
+  ASSERT_EQ(out->size(), frames.offsets.back());
+  ASSERT_EQ(static_cast<int64_t>(data.size()), frames.uncompressed_length);
+
+  for (int decompress_threads : {1, num_threads}) {
+    vector<uint8_t> decompressed(data.size());
+    ASSERT_OK(DecompressFrames(
+        compression, out->data(), frames, decompress_threads, decompressed.data()));
+    ASSERT_EQ(data, decompressed);
+  }
+
+  // Compressing on one thread gives the same output
+  std::shared_ptr<Buffer> serial_out;
+  CompressedFrames serial_frames;
+  ASSERT_OK(CompressFrames(compression, data.size(), data.data(), block_size, 1,
+      default_memory_pool(), &serial_out, &serial_frames));
+  ASSERT_EQ(frames.offsets, serial_frames.offsets);
+  ASSERT_TRUE(out->Equals(*serial_out));
+
+  if (compressed != nullptr) { *compressed = out; }
+}
+
+TEST(TestCompressFrames, Roundtrip) {
+  vector<uint8_t> data = MakeCompressibleData(100000);
+  for (auto compression : {Compression::SNAPPY, Compression::GZIP,
+           Compression::BROTLI, Compression::ZSTD, Compression::LZ4}) {
+    // Last frame shorter than the others, more frames than threads, a single frame
+    CheckFramesRoundtrip(compression, data, 7000, 4);
+    CheckFramesRoundtrip(compression, data, 1 << 20, 4);
+  }
+}
+
+TEST(TestCompressFrames, EmptyInput) {
+  vector<uint8_t> data;
+  CheckFramesRoundtrip(Compression::ZSTD, data, 1000, 4);
+  CheckFramesRoundtrip(Compression::LZ4, data, 1000, 4);
+}
+
+TEST(TestCompressFrames, ZSTDMultiFrame) {
+  vector<uint8_t> data = MakeCompressibleData(100000);
+  std::shared_ptr<Buffer> compressed;
+  CheckFramesRoundtrip(Compression::ZSTD, data, 7000, 4, &compressed);
+
+  // The standard decoder reads the concatenated frames as one stream
+  vector<uint8_t> decompressed(data.size());
+  size_t ret = ZSTD_decompress(decompressed.data(), decompressed.size(),
+      compressed->data(), static_cast<size_t>(compressed->size()));
+  ASSERT_FALSE(ZSTD_isError(ret));
+  ASSERT_EQ(data.size(), ret);
+  ASSERT_EQ(data, decompressed);
+}
+
+TEST(TestCompressFrames, Lz4MultiFrame) {
+  vector<uint8_t> data = MakeCompressibleData(100000);
+  std::shared_ptr<Buffer> compressed;
+  CheckFramesRoundtrip(Compression::LZ4, data, 7000, 4, &compressed);
+
+  // The standard decoder reads the concatenated frames as one stream
+  LZ4F_decompressionContext_t context;
+  ASSERT_FALSE(LZ4F_isError(LZ4F_createDecompressionContext(&context, LZ4F_VERSION)));
+  vector<uint8_t> decompressed(data.size());
+  size_t src_pos = 0;
+  size_t dst_pos = 0;
+  while (src_pos < static_cast<size_t>(compressed->size())) {
+    size_t src_size = compressed->size() - src_pos;
+    size_t dst_size = decompressed.size() - dst_pos;
+    size_t ret = LZ4F_decompress(context, decompressed.data() + dst_pos, &dst_size,
+        compressed->data() + src_pos, &src_size, nullptr);
+    ASSERT_FALSE(LZ4F_isError(ret));
+    src_pos += src_size;
+    dst_pos += dst_size;
+  }
+  LZ4F_freeDecompressionContext(context);
+  ASSERT_EQ(data.size(), dst_pos);
+  ASSERT_EQ(data, decompressed);
+}
+
+TEST(TestCompressFrames, InvalidArguments) {
+  vector<uint8_t> data = MakeCompressibleData(1000);
+  std::shared_ptr<Buffer> out;
+  CompressedFrames frames;
+  ASSERT_RAISES(Invalid, CompressFrames(Compression::UNCOMPRESSED, data.size(),
+                             data.data(), 100, 2, default_memory_pool(), &out, &frames));
+  ASSERT_RAISES(Invalid, CompressFrames(Compression::ZSTD, data.size(), data.data(), 0,
+                             2, default_memory_pool(), &out, &frames));
+
+  ASSERT_OK(CompressFrames(Compression::ZSTD, data.size(), data.data(), 100, 2,
+      default_memory_pool(), &out, &frames));
+  vector<uint8_t> decompressed(data.size());
+  CompressedFrames bad_frames = frames;
+  bad_frames.offsets.pop_back();
+  ASSERT_RAISES(Invalid, DecompressFrames(Compression::ZSTD, out->data(), bad_frames, 2,
+                             decompressed.data()));
+
+  // A frame decompressed with the wrong codec
+  ASSERT_RAISES(IOError,
+      DecompressFrames(Compression::LZ4, out->data(), frames, 2, decompressed.data()));
+}
+
 }  // namespace arrow
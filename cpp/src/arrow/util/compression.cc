@@ -17,25 +17,36 @@
 
 #include "arrow/util/compression.h"
 
+// Included before the Snappy workaround below, which undefines the
+// DISALLOW_COPY_AND_ASSIGN they use
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+
 // Work around warning caused by Snappy include
 #ifdef DISALLOW_COPY_AND_ASSIGN
 #undef DISALLOW_COPY_AND_ASSIGN
 #endif
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
+#include <functional>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <brotli/decode.h>
 #include <brotli/encode.h>
 #include <lz4.h>
+#include <lz4frame.h>
 #include <snappy.h>
 #include <zlib.h>
 #include <zstd.h>
 
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow {
 
@@ -56,6 +67,12 @@ Status Codec::Create(Compression::type codec_type, std::unique_ptr<Codec>* resul
     case Compression::BROTLI:
       result->reset(new BrotliCodec());
       break;
+    case Compression::ZSTD:
+      result->reset(new ZSTDCodec());
+      break;
+    case Compression::LZ4:
+      result->reset(new Lz4Codec());
+      break;
     default:
       return Status::Invalid("Unrecognized codec");
   }
@@ -383,4 +400,180 @@ Status Lz4Codec::Compress(int64_t input_len, const uint8_t* input,
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Block-parallel compression
+
+namespace {
+
+// Compresses and decompresses single frames. ZSTD frames come from ZSTDCodec
+// as they are; LZ4 uses the frame API rather than the raw blocks of Lz4Codec,
+// so that the frames can be concatenated. Used by one thread at a time
+class FrameCodec {
+ public:
+  explicit FrameCodec(Compression::type compression)
+      : compression_(compression), lz4_context_(nullptr) {}
+
+  ~FrameCodec() {
+    if (lz4_context_ != nullptr) { LZ4F_freeDecompressionContext(lz4_context_); }
+  }
+
+  Status Init() {
+    if (compression_ != Compression::LZ4) { return Codec::Create(compression_, &codec_); }
+    if (LZ4F_isError(LZ4F_createDecompressionContext(&lz4_context_, LZ4F_VERSION))) {
+      return Status::OutOfMemory("Could not create Lz4 decompression context");
+    }
+    return Status::OK();
+  }
+
+  int64_t MaxCompressedLen(int64_t input_len, const uint8_t* input) {
+    if (compression_ != Compression::LZ4) {
+      return codec_->MaxCompressedLen(input_len, input);
+    }
+    LZ4F_preferences_t prefs;
+    InitLz4Preferences(input_len, &prefs);
+    return static_cast<int64_t>(
+        LZ4F_compressFrameBound(static_cast<size_t>(input_len), &prefs));
+  }
+
+  Status Compress(int64_t input_len, const uint8_t* input, int64_t output_buffer_len,
+      uint8_t* output_buffer, int64_t* output_length) {
+    if (compression_ != Compression::LZ4) {
+      return codec_->Compress(
+          input_len, input, output_buffer_len, output_buffer, output_length);
+    }
+    LZ4F_preferences_t prefs;
+    InitLz4Preferences(input_len, &prefs);
+    size_t ret = LZ4F_compressFrame(output_buffer, static_cast<size_t>(output_buffer_len),
+        input, static_cast<size_t>(input_len), &prefs);
+    if (LZ4F_isError(ret)) { return Status::IOError("Lz4 compression failure."); }
+    *output_length = static_cast<int64_t>(ret);
+    return Status::OK();
+  }
+
+  Status Decompress(int64_t input_len, const uint8_t* input, int64_t output_len,
+      uint8_t* output_buffer) {
+    if (compression_ != Compression::LZ4) {
+      return codec_->Decompress(input_len, input, output_len, output_buffer);
+    }
+    size_t src_size = static_cast<size_t>(input_len);
+    size_t dst_size = static_cast<size_t>(output_len);
+    size_t ret = LZ4F_decompress(
+        lz4_context_, output_buffer, &dst_size, input, &src_size, nullptr);
+    // A complete frame is consumed whole and leaves the context ready for the
+    // next one
+    if (LZ4F_isError(ret) || ret != 0 || static_cast<int64_t>(src_size) != input_len ||
+        static_cast<int64_t>(dst_size) != output_len) {
+      return Status::IOError("Corrupt Lz4 compressed data.");
+    }
+    return Status::OK();
+  }
+
+ private:
+  static void InitLz4Preferences(int64_t input_len, LZ4F_preferences_t* prefs) {
+    std::memset(prefs, 0, sizeof(LZ4F_preferences_t));
+    prefs->frameInfo.contentSize = static_cast<unsigned long long>(input_len);
+  }
+
+  Compression::type compression_;
+  std::unique_ptr<Codec> codec_;
+  LZ4F_decompressionContext_t lz4_context_;
+};
+
+// Call func for every frame on up to num_threads threads, each thread with its
+// own FrameCodec
+Status ForEachFrame(Compression::type compression, int64_t num_frames, int num_threads,
+    const std::function<Status(FrameCodec*, int64_t)>& func) {
+  std::vector<std::unique_ptr<FrameCodec>> codecs(num_threads);
+  return ParallelFor(num_frames, num_threads, [&](int thread_index, int64_t i) {
+    std::unique_ptr<FrameCodec>& codec = codecs[thread_index];
+    if (!codec) {
+      codec.reset(new FrameCodec(compression));
+      RETURN_NOT_OK(codec->Init());
+    }
+    return func(codec.get(), i);
+  });
+}
+
+Status CheckFrameCompression(Compression::type compression) {
+  if (compression == Compression::UNCOMPRESSED) {
+    return Status::Invalid("Frames must be compressed with a codec");
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status CompressFrames(Compression::type compression, int64_t input_len,
+    const uint8_t* input, int64_t block_size, int num_threads, MemoryPool* pool,
+    std::shared_ptr<Buffer>* out, CompressedFrames* frames) {
+  RETURN_NOT_OK(CheckFrameCompression(compression));
+  if (block_size <= 0) { return Status::Invalid("Block size must be positive"); }
+  if (num_threads <= 0) { return Status::Invalid("Number of threads must be positive"); }
+
+  const int64_t num_frames = (input_len + block_size - 1) / block_size;
+  auto FrameLength = [&](int64_t i) {
+    return std::min(block_size, input_len - i * block_size);
+  };
+
+  // Frames are compressed into fixed size slots of the output, then moved down
+  // next to each other
+  FrameCodec bound_codec(compression);
+  RETURN_NOT_OK(bound_codec.Init());
+  const int64_t slot_size =
+      num_frames == 0 ? 0 : bound_codec.MaxCompressedLen(FrameLength(0), input);
+
+  std::shared_ptr<ResizableBuffer> buffer;
+  RETURN_NOT_OK(AllocateResizableBuffer(pool, num_frames * slot_size, &buffer));
+  uint8_t* data = buffer->mutable_data();
+
+  std::vector<int64_t> compressed_lengths(num_frames);
+  RETURN_NOT_OK(ForEachFrame(compression, num_frames, num_threads,
+      [&](FrameCodec* codec, int64_t i) {
+        return codec->Compress(FrameLength(i), input + i * block_size, slot_size,
+            data + i * slot_size, &compressed_lengths[i]);
+      }));
+
+  frames->block_size = block_size;
+  frames->uncompressed_length = input_len;
+  frames->offsets.assign(1, 0);
+  for (int64_t i = 0; i < num_frames; ++i) {
+    const int64_t offset = frames->offsets.back();
+    if (offset != i * slot_size) {
+      std::memmove(data + offset, data + i * slot_size,
+          static_cast<size_t>(compressed_lengths[i]));
+    }
+    frames->offsets.push_back(offset + compressed_lengths[i]);
+  }
+
+  RETURN_NOT_OK(buffer->Resize(frames->offsets.back()));
+  *out = buffer;
+  return Status::OK();
+}
+
+Status DecompressFrames(Compression::type compression, const uint8_t* input,
+    const CompressedFrames& frames, int num_threads, uint8_t* output_buffer) {
+  RETURN_NOT_OK(CheckFrameCompression(compression));
+  if (num_threads <= 0) { return Status::Invalid("Number of threads must be positive"); }
+
+  const int64_t block_size = frames.block_size;
+  const int64_t num_frames = frames.num_frames();
+  if (block_size <= 0 || frames.uncompressed_length < 0 ||
+      num_frames != (frames.uncompressed_length + block_size - 1) / block_size) {
+    return Status::Invalid("Frame layout does not match the uncompressed length");
+  }
+  for (int64_t i = 0; i < num_frames; ++i) {
+    if (frames.offsets[i + 1] < frames.offsets[i]) {
+      return Status::Invalid("Frame offsets must be increasing");
+    }
+  }
+
+  return ForEachFrame(compression, num_frames, num_threads,
+      [&](FrameCodec* codec, int64_t i) {
+        const int64_t offset = frames.offsets[i];
+        return codec->Decompress(frames.offsets[i + 1] - offset, input + offset,
+            std::min(block_size, frames.uncompressed_length - i * block_size),
+            output_buffer + i * block_size);
+      });
+}
+
 }  // namespace arrow
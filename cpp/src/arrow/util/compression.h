@@ -20,12 +20,16 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/status.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
 
+class Buffer;
+class MemoryPool;
+
 struct Compression {
   enum type { UNCOMPRESSED, SNAPPY, GZIP, LZO, BROTLI, ZSTD, LZ4 };
 };
@@ -132,6 +136,57 @@ class ARROW_EXPORT Lz4Codec : public Codec {
   const char* name() const override { return "lz4"; }
 };
 
+// ----------------------------------------------------------------------
+// Block-parallel compression
+
+/// \brief The layout of data compressed by CompressFrames: independently
+/// compressed frames of block_size uncompressed bytes each, the last one
+/// possibly shorter, stored back to back
+struct ARROW_EXPORT CompressedFrames {
+  CompressedFrames() : block_size(0), uncompressed_length(0) {}
+
+  int64_t block_size;
+  int64_t uncompressed_length;
+
+  /// The offset of each frame in the compressed data, followed by the length
+  /// of the compressed data
+  std::vector<int64_t> offsets;
+
+  int64_t num_frames() const {
+    return offsets.empty() ? 0 : static_cast<int64_t>(offsets.size()) - 1;
+  }
+};
+
+/// \brief Compress a buffer as independent frames on several threads
+///
+/// Each thread compresses with its own codec. ZSTD and LZ4 frames use the
+/// frame formats of those libraries, so the output as a whole is a valid
+/// multi-frame stream for their standard decoders
+///
+/// \param[in] compression the codec to compress with
+/// \param[in] input_len the number of bytes to compress
+/// \param[in] input the data to compress
+/// \param[in] block_size the number of uncompressed bytes in each frame
+/// \param[in] num_threads the maximum number of threads to use
+/// \param[in] pool the memory pool for the compressed buffer
+/// \param[out] out the compressed frames
+/// \param[out] frames the layout of the frames in out
+ARROW_EXPORT
+Status CompressFrames(Compression::type compression, int64_t input_len,
+    const uint8_t* input, int64_t block_size, int num_threads, MemoryPool* pool,
+    std::shared_ptr<Buffer>* out, CompressedFrames* frames);
+
+/// \brief Decompress the output of CompressFrames on several threads
+///
+/// \param[in] compression the codec the frames were compressed with
+/// \param[in] input the compressed frames
+/// \param[in] frames the layout of the frames in input
+/// \param[in] num_threads the maximum number of threads to use
+/// \param[out] output_buffer frames.uncompressed_length bytes to decompress to
+ARROW_EXPORT
+Status DecompressFrames(Compression::type compression, const uint8_t* input,
+    const CompressedFrames& frames, int num_threads, uint8_t* output_buffer);
+
 }  // namespace arrow
 
 #endif
@@ -63,7 +63,7 @@ static struct {
   int64_t flag;
 } flag_mappings[] = {
     {"ssse3", CpuInfo::SSSE3}, {"sse4_1", CpuInfo::SSE4_1}, {"sse4_2", CpuInfo::SSE4_2},
-    {"popcnt", CpuInfo::POPCNT},
+    {"popcnt", CpuInfo::POPCNT}, {"avx2", CpuInfo::AVX2},
 };
 static const int64_t num_flags = sizeof(flag_mappings) / sizeof(flag_mappings[0]);
 
@@ -0,0 +1,77 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "benchmark/benchmark.h"
+
+#include <string>
+#include <vector>
+
+#include "arrow/test-util.h"
+#include "arrow/util/decimal.h"
+
+namespace arrow {
+namespace decimal {
+
+// Decimal strings that fit each storage width, with and without signs and
+// fractional digits
+static std::vector<std::string> MakeValues(int max_digits) {
+  const std::vector<std::string> templates = {"12345678901234567890123456789012345678",
+      "-1234567.89012345678901234567890123456", "+0.0000012345678901234567890123456789",
+      "98765432109876543210987654321098765.432"};
+
+  std::vector<std::string> values;
+  for (const std::string& value : templates) {
+    // Keep the sign, the decimal point and max_digits digits
+    std::string truncated;
+    int digits = 0;
+    for (char c : value) {
+      if (c >= '0' && c <= '9') {
+        if (digits == max_digits) { break; }
+        ++digits;
+      }
+      truncated += c;
+    }
+    values.push_back(truncated);
+  }
+  return values;
+}
+
+template <typename T>
+static void BM_FromString(benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<std::string> values =
+      MakeValues(static_cast<int>(state.range(0)));
+  int64_t total_bytes = 0;
+  for (const std::string& value : values) {
+    total_bytes += static_cast<int64_t>(value.size());
+  }
+
+  Decimal<T> out;
+  while (state.KeepRunning()) {
+    for (const std::string& value : values) {
+      ABORT_NOT_OK(FromString(value, &out));
+    }
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetBytesProcessed(state.iterations() * total_bytes);
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+BENCHMARK_TEMPLATE(BM_FromString, int32_t)->Arg(9);
+BENCHMARK_TEMPLATE(BM_FromString, int64_t)->Arg(9)->Arg(18);
+BENCHMARK_TEMPLATE(BM_FromString, int128_t)->Arg(9)->Arg(18)->Arg(38);
+
+}  // namespace decimal
+}  // namespace arrow
@@ -95,6 +95,17 @@ TEST(DecimalTest, TestStringToInt128) {
   ASSERT_EQ(value, 123456789456789123);
 }
 
+TEST(DecimalTest, TestStringToInt128LeadingZeros) {
+  // Digits with leading zeros are still decimal, not octal
+  int128_t value = 0;
+  StringToInteger("", "0000012389", -1, &value);
+  ASSERT_EQ(value, -12389);
+
+  Decimal128 result;
+  ASSERT_OK(FromString("+0.00000123456789012345678", &result));
+  ASSERT_EQ(result.value, 123456789012345678);
+}
+
 TEST(DecimalTest, TestFromString128) {
   static const std::string string_value("-23049223942343532412");
   Decimal<int128_t> result(string_value);
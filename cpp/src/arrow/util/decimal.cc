@@ -172,7 +172,16 @@ void StringToInteger(
   DCHECK(sign == -1 || sign == 1);
   DCHECK_NE(out, nullptr);
   DCHECK(!whole.empty() || !fractional.empty());
-  *out = int128_t(whole + fractional) * sign;
+  // Accumulate the digits directly: constructing int128_t from the string
+  // would parse fractional parts with leading zeros as octal
+  int128_t value = 0;
+  for (char c : whole) {
+    value = value * 10 + (c - '0');
+  }
+  for (char c : fractional) {
+    value = value * 10 + (c - '0');
+  }
+  *out = value * sign;
 }
 
 void FromBytes(const uint8_t* bytes, Decimal32* decimal) {
@@ -0,0 +1,82 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "arrow/test-util.h"
+#include "arrow/util/cpu-info.h"
+#include "arrow/util/hash-util.h"
+
+namespace arrow {
+
+// Total bytes hashed per iteration, split into keys of state.range(0) bytes
+constexpr int64_t kTotalSize = 1 << 20;
+
+static std::vector<uint8_t> MakeKeys() {
+  std::vector<uint8_t> data(kTotalSize);
+  test::random_bytes(kTotalSize, 0, data.data());
+  return data;
+}
+
+template <typename HashFunc>
+static void BenchmarkHash(benchmark::State& state, HashFunc&& hash) {
+  const std::vector<uint8_t> data = MakeKeys();
+  const int32_t key_size = static_cast<int32_t>(state.range(0));
+  const int64_t num_keys = kTotalSize / key_size;
+
+  while (state.KeepRunning()) {
+    uint64_t total = 0;
+    for (int64_t i = 0; i < num_keys; ++i) {
+      total += hash(data.data() + i * key_size, key_size);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetBytesProcessed(state.iterations() * num_keys * key_size);
+}
+
+static void BM_CrcHash(benchmark::State& state) {  // NOLINT non-const reference
+  if (!CpuInfo::initialized()) { CpuInfo::Init(); }
+#ifdef ARROW_USE_SSE
+  if (CpuInfo::IsSupported(CpuInfo::SSE4_2)) {
+    BenchmarkHash(state, [](const uint8_t* key, int32_t size) {
+      return HashUtil::CrcHash(key, size, 0);
+    });
+    return;
+  }
+#endif
+  state.SkipWithError("CrcHash requires SSE4.2");
+}
+
+static void BM_MurmurHash2_64(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkHash(state, [](const uint8_t* key, int32_t size) {
+    return HashUtil::MurmurHash2_64(key, size, 0);
+  });
+}
+
+static void BM_FnvHash64(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkHash(state, [](const uint8_t* key, int32_t size) {
+    return HashUtil::FnvHash64(key, size, HashUtil::FNV64_SEED);
+  });
+}
+
+BENCHMARK(BM_CrcHash)->Arg(4)->Arg(8)->Arg(16)->Arg(64)->Arg(1024);
+BENCHMARK(BM_MurmurHash2_64)->Arg(4)->Arg(8)->Arg(16)->Arg(64)->Arg(1024);
+BENCHMARK(BM_FnvHash64)->Arg(4)->Arg(8)->Arg(16)->Arg(64)->Arg(1024);
+
+}  // namespace arrow
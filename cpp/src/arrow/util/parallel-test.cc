@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "arrow/test-util.h"
+#include "arrow/util/parallel.h"
+
+namespace arrow {
+
+TEST(ParallelFor, RunsEveryTask) {
+  const int64_t num_tasks = 1000;
+  std::vector<std::atomic<int>> counts(num_tasks);
+  for (auto& count : counts) {
+    count = 0;
+  }
+
+  std::mutex lock;
+  std::set<int> thread_indices;
+  ASSERT_OK(ParallelFor(num_tasks, 4, [&](int thread_index, int64_t i) {
+    counts[i]++;
+    std::lock_guard<std::mutex> guard(lock);
+    thread_indices.insert(thread_index);
+    return Status::OK();
+  }));
+
+  for (const auto& count : counts) {
+    ASSERT_EQ(1, count);
+  }
+  ASSERT_GE(*thread_indices.begin(), 0);
+  ASSERT_LT(*thread_indices.rbegin(), 4);
+}
+
+TEST(ParallelFor, NestedLoopsRunInline) {
+  std::atomic<int> num_tasks(0);
+  ASSERT_OK(ParallelFor(4, 4, [&](int, int64_t) {
+    const std::thread::id outer_thread = std::this_thread::get_id();
+    return ParallelFor(10, 4, [&](int thread_index, int64_t) {
+      num_tasks++;
+      if (thread_index != 0 || std::this_thread::get_id() != outer_thread) {
+        return Status::Invalid("Nested task ran on another thread");
+      }
+      return Status::OK();
+    });
+  }));
+  ASSERT_EQ(40, num_tasks);
+
+  // Outside of a parallel loop, threads are used again
+  std::mutex lock;
+  std::set<std::thread::id> threads;
+  ASSERT_OK(ParallelFor(100, 4, [&](int, int64_t) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    std::lock_guard<std::mutex> guard(lock);
+    threads.insert(std::this_thread::get_id());
+    return Status::OK();
+  }));
+  ASSERT_GT(threads.size(), 1u);
+}
+
+TEST(ParallelFor, Errors) {
+  Status st = ParallelFor(1000, 4, [](int, int64_t i) {
+    if (i == 10) { return Status::IOError("task failed"); }
+    return Status::OK();
+  });
+  ASSERT_TRUE(st.IsIOError());
+
+  ASSERT_RAISES(Invalid, ParallelFor(10, 0, [](int, int64_t) { return Status::OK(); }));
+
+  // No tasks
+  ASSERT_OK(ParallelFor(0, 4, [](int, int64_t) { return Status::Invalid("no"); }));
+}
+
+}  // namespace arrow
@@ -0,0 +1,75 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace arrow {
+
+// Whether the current thread is running a ParallelFor task
+static thread_local bool in_parallel_region = false;
+
+Status ParallelFor(int64_t num_tasks, int num_threads,
+    const std::function<Status(int thread_index, int64_t i)>& func) {
+  if (num_threads <= 0) { return Status::Invalid("Number of threads must be positive"); }
+  if (in_parallel_region) { num_threads = 1; }
+  num_threads = static_cast<int>(std::min<int64_t>(num_threads, num_tasks));
+
+  if (num_threads <= 1) {
+    for (int64_t i = 0; i < num_tasks; ++i) {
+      RETURN_NOT_OK(func(0, i));
+    }
+    return Status::OK();
+  }
+
+  std::atomic<int64_t> next_task(0);
+  std::vector<Status> statuses(num_threads);
+  auto RunTasks = [&](int thread_index) {
+    const bool was_in_parallel_region = in_parallel_region;
+    in_parallel_region = true;
+    for (int64_t i = next_task++; i < num_tasks; i = next_task++) {
+      Status st = func(thread_index, i);
+      if (!st.ok()) {
+        // Stop the other threads early
+        next_task = num_tasks;
+        statuses[thread_index] = st;
+        break;
+      }
+    }
+    in_parallel_region = was_in_parallel_region;
+  };
+
+  std::vector<std::thread> threads;
+  for (int i = 1; i < num_threads; ++i) {
+    threads.emplace_back(RunTasks, i);
+  }
+  RunTasks(0);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (const Status& st : statuses) {
+    RETURN_NOT_OK(st);
+  }
+  return Status::OK();
+}
+
+}  // namespace arrow
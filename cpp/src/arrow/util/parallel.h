@@ -0,0 +1,45 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_UTIL_PARALLEL_H
+#define ARROW_UTIL_PARALLEL_H
+
+#include <cstdint>
+#include <functional>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+/// \brief Call func(thread_index, i) for each i in [0, num_tasks) on up to
+/// num_threads threads, the calling thread included
+///
+/// Each thread takes the next task until none are left, so thread_index, in
+/// [0, num_threads), can index per-thread state such as a codec. After a task
+/// fails no further tasks are started, and its error is returned.
+///
+/// When called from inside a task of another ParallelFor, the tasks run in turn
+/// on the calling thread, so nested parallel loops do not multiply the number
+/// of threads.
+ARROW_EXPORT
+Status ParallelFor(int64_t num_tasks, int num_threads,
+    const std::function<Status(int thread_index, int64_t i)>& func);
+
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_PARALLEL_H
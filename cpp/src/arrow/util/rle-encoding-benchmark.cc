@@ -0,0 +1,106 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "arrow/test-util.h"
+#include "arrow/util/bit-stream-utils.h"
+#include "arrow/util/bpacking.h"
+#include "arrow/util/rle-encoding.h"
+
+namespace arrow {
+
+constexpr int kNumValues = 1 << 16;
+
+// Values of the given bit width, in runs of 1 to 16 repeated values so that
+// both repeated and literal runs are encoded
+static std::vector<uint32_t> MakeValues(int bit_width) {
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<uint32_t> value_dist(
+      0, static_cast<uint32_t>((UINT64_C(1) << bit_width) - 1));
+  std::uniform_int_distribution<int> run_dist(1, 16);
+
+  std::vector<uint32_t> values;
+  while (static_cast<int>(values.size()) < kNumValues) {
+    const uint32_t value = value_dist(gen);
+    const int run_length = run_dist(gen);
+    for (int i = 0; i < run_length && static_cast<int>(values.size()) < kNumValues; ++i) {
+      values.push_back(value);
+    }
+  }
+  return values;
+}
+
+static void BM_RleEncode(benchmark::State& state) {  // NOLINT non-const reference
+  const int bit_width = static_cast<int>(state.range(0));
+  const std::vector<uint32_t> values = MakeValues(bit_width);
+  std::vector<uint8_t> buffer(RleEncoder::MaxBufferSize(bit_width, kNumValues));
+
+  while (state.KeepRunning()) {
+    RleEncoder encoder(buffer.data(), static_cast<int>(buffer.size()), bit_width);
+    for (uint32_t value : values) {
+      if (!encoder.Put(value)) { state.SkipWithError("Buffer too small"); }
+    }
+    benchmark::DoNotOptimize(encoder.Flush());
+  }
+  state.SetBytesProcessed(state.iterations() * kNumValues * sizeof(uint32_t));
+}
+
+static void BM_RleDecode(benchmark::State& state) {  // NOLINT non-const reference
+  const int bit_width = static_cast<int>(state.range(0));
+  const std::vector<uint32_t> values = MakeValues(bit_width);
+  std::vector<uint8_t> buffer(RleEncoder::MaxBufferSize(bit_width, kNumValues));
+
+  RleEncoder encoder(buffer.data(), static_cast<int>(buffer.size()), bit_width);
+  for (uint32_t value : values) {
+    encoder.Put(value);
+  }
+  const int encoded_length = encoder.Flush();
+
+  std::vector<int32_t> decoded(kNumValues);
+  while (state.KeepRunning()) {
+    RleDecoder decoder(buffer.data(), encoded_length, bit_width);
+    if (decoder.GetBatch(decoded.data(), kNumValues) != kNumValues) {
+      state.SkipWithError("Decoded too few values");
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * kNumValues * sizeof(int32_t));
+}
+
+// unpack32 dispatches to the unpackN_32 kernel for the bit width
+static void BM_Unpack32(benchmark::State& state) {  // NOLINT non-const reference
+  const int bit_width = static_cast<int>(state.range(0));
+  std::vector<uint32_t> packed(kNumValues * bit_width / 32);
+  test::random_bytes(packed.size() * sizeof(uint32_t), 0,
+      reinterpret_cast<uint8_t*>(packed.data()));
+  std::vector<uint32_t> unpacked(kNumValues);
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(
+        unpack32(packed.data(), unpacked.data(), kNumValues, bit_width));
+  }
+  state.SetBytesProcessed(state.iterations() * kNumValues * sizeof(uint32_t));
+}
+
+BENCHMARK(BM_RleEncode)->DenseRange(1, 32);
+BENCHMARK(BM_RleDecode)->DenseRange(1, 32);
+BENCHMARK(BM_Unpack32)->DenseRange(1, 32);
+
+}  // namespace arrow